@@ -4,6 +4,30 @@
 // Export Headers.
 #include "include/CoreString.h"
 #include "include/CoreString_Utils.h"
+#include "include/CoreString_CaseInsensitive.h"
+#include "include/CoreString_CsvTokenizer.h"
+#include "include/CoreString_EditDistance.h"
+#include "include/CoreString_Encoding.h"
+#include "include/CoreString_Escape.h"
+#include "include/CoreString_FormatTemplate.h"
+#include "include/CoreString_FrontCodedDictionary.h"
+#include "include/CoreString_Generic.h"
+#include "include/CoreString_Hash.h"
+#include "include/CoreString_Histogram.h"
+#include "include/CoreString_InternPool.h"
+#include "include/CoreString_KeyValueParser.h"
+#include "include/CoreString_KeywordSet.h"
+#include "include/CoreString_Number.h"
+#include "include/CoreString_InlineString.h"
+#include "include/CoreString_Pipe.h"
+#include "include/CoreString_Rope.h"
+#include "include/CoreString_ScratchPool.h"
+#include "include/CoreString_Sort.h"
+#include "include/CoreString_StreamSearcher.h"
+#include "include/CoreString_StringTable.h"
+#include "include/CoreString_TrigramIndex.h"
+#include "include/CoreString_WhiteSpace.h"
+#include "include/CoreString_Wildcard.h"
 
 
 
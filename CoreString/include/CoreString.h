@@ -4,12 +4,18 @@
 
 // std
 #include <string>
+#include <string_view>
 #include <initializer_list>
 #include <sstream>
 #include <algorithm>
+#include <cctype>
+#include <cstdio>
 #include <vector>
 // CoreString
 #include "CoreString_Utils.h"
+#include "CoreString_Number.h"
+#include "CoreString_ScratchPool.h"
+#include "CoreString_WhiteSpace.h"
 //
 #include "../libs/asprintf/asprintf.h"
 
@@ -18,23 +24,49 @@ NS_CORESTRING_BEGIN
 
 namespace Private_Concat
 {
+    //--------------------------------------------------------------------------
+    // Appends the string representation of value to out.
+    //   Numbers and strings are appended directly, only the
+    //   other types need to go through the operator <<.
+    template <typename T>
+    void AppendTo(std::string &out, const T &value)
+    {
+        if constexpr(Private_Number::IsNumber<T>)
+        {
+            ToStringTo(out, value);
+        }
+        else if constexpr(std::is_convertible_v<const T &, std::string_view>)
+        {
+            out.append(std::string_view(value));
+        }
+        else if constexpr(std::is_same_v<T, char>)
+        {
+            out.push_back(value);
+        }
+        else
+        {
+            std::stringstream ss;
+            ss << value;
+            out.append(ss.str());
+        }
+    }
+
     template <typename T> std::string
     Concat(const T &value)
     {
-        std::stringstream ss;
-        ss << value;
-        return ss.str();
+        auto str = std::string();
+        AppendTo(str, value);
+        return str;
     }
 }
 
-namespace Private_Join
+namespace Private_Case
 {
-    template <typename T>
-    std::string Join(const std::string &separator, const T &value)
+    inline char ToLower(char c) noexcept { return char(tolower((unsigned char)c)); }
+    inline char ToUpper(char c) noexcept { return char(toupper((unsigned char)c)); }
+    inline char SwapCase(char c) noexcept
     {
-        std::stringstream ss;
-        ss << value << separator;
-        return ss.str();
+        return isupper((unsigned char)c) ? ToLower(c) : ToUpper(c);
     }
 }
 
@@ -60,6 +92,27 @@ namespace Private_Format
 ///   Return a copy of the string S with only its first character capitalized.
 std::string Capitalize(const std::string &str);
 
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as Capitalize but appends the result to out instead of returning
+///   a new string, so the same buffer can be reused between calls.
+void CapitalizeTo(std::string &out, std::string_view str);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as CapitalizeTo but writes the result to a output iterator.
+/// @returns
+///   The iterator past the last written char.
+template <typename OutputIt>
+OutputIt CapitalizeTo(OutputIt out, std::string_view str)
+{
+    if(str.empty())
+        return out;
+
+    *out++ = Private_Case::ToUpper(str[0]);
+    return std::copy(std::begin(str) + 1, std::end(str), out);
+}
+
 
 ///-----------------------------------------------------------------------------
 /// @brief
@@ -67,6 +120,28 @@ std::string Capitalize(const std::string &str);
 ///   done using the specified fill character (default is a space)
 std::string Center(const std::string &str, size_t length, char c = ' ');
 
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as Center but appends the result to out instead of returning
+///   a new string, so the same buffer can be reused between calls.
+void CenterTo(std::string &out, std::string_view str, size_t length, char c = ' ');
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as CenterTo but writes the result to a output iterator.
+/// @returns
+///   The iterator past the last written char.
+template <typename OutputIt>
+OutputIt CenterTo(OutputIt out, std::string_view str, size_t length, char c = ' ')
+{
+    auto padding = (str.size() < length) ? (length - str.size()) : 0;
+    auto left    = padding / 2;
+
+    out = std::fill_n(out, left, c);
+    out = std::copy(std::begin(str), std::end(str), out);
+    return std::fill_n(out, padding - left, c);
+}
+
 
 ///-----------------------------------------------------------------------------
 /// @brief
@@ -86,6 +161,30 @@ size_t Count(
 ///  If tabsize is not given, a tab size of 8 characters is assumed.
 std::string ExpandTabs(const std::string &str, size_t tabSize = 8);
 
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as ExpandTabs but appends the result to out instead of returning
+///   a new string, so the same buffer can be reused between calls.
+void ExpandTabsTo(std::string &out, std::string_view str, size_t tabSize = 8);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as ExpandTabsTo but writes the result to a output iterator.
+/// @returns
+///   The iterator past the last written char.
+template <typename OutputIt>
+OutputIt ExpandTabsTo(OutputIt out, std::string_view str, size_t tabSize = 8)
+{
+    for(auto c : str)
+    {
+        if(c == '\t')
+            out = std::fill_n(out, tabSize, ' ');
+        else
+            *out++ = c;
+    }
+    return out;
+}
+
 
 ///-----------------------------------------------------------------------------
 /// @brief
@@ -142,6 +241,28 @@ bool IsUpper(const std::string &str);
 ///   converted to lowercase and vice versa.
 std::string SwapCase(const std::string &str);
 
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as SwapCase but appends the result to out instead of returning
+///   a new string, so the same buffer can be reused between calls.
+void SwapCaseTo(std::string &out, std::string_view str);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as SwapCaseTo but writes the result to a output iterator.
+/// @returns
+///   The iterator past the last written char.
+template <typename OutputIt>
+OutputIt SwapCaseTo(OutputIt out, std::string_view str)
+{
+    return std::transform(
+        std::begin(str),
+        std::end  (str),
+        out,
+        Private_Case::SwapCase
+    );
+}
+
 
 ///-----------------------------------------------------------------------------
 /// @brief
@@ -149,6 +270,32 @@ std::string SwapCase(const std::string &str);
 ///   characters, all remaining cased characters have lowercase.
 std::string Title(const std::string &str);
 
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as Title but appends the result to out instead of returning
+///   a new string, so the same buffer can be reused between calls.
+void TitleTo(std::string &out, std::string_view str);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as TitleTo but writes the result to a output iterator.
+/// @returns
+///   The iterator past the last written char.
+template <typename OutputIt>
+OutputIt TitleTo(OutputIt out, std::string_view str)
+{
+    if(str.empty())
+        return out;
+
+    *out++ = Private_Case::ToUpper(str[0]);
+    return std::transform(
+        std::begin(str) + 1,
+        std::end  (str),
+        out,
+        Private_Case::ToLower
+    );
+}
+
 
 ///-----------------------------------------------------------------------------
 /// @brief
@@ -159,13 +306,19 @@ std::string Title(const std::string &str);
 /// @returns
 ///   The string with all items concatenated.
 /// @note
-///   This function use the operator << to tranform the item into the
+///   Numbers are converted with ToString and strings are appended as is,
+///   the other types use the operator << to tranform the item into the
 ///   its string representation.
 template <typename T, typename... Args>
 std::string Concat(const T& first, const Args&... args)
 {
     using namespace Private_Concat;
-    return Concat(first) +  Concat(args...);
+
+    auto str = std::string();
+    AppendTo(str, first);
+    (AppendTo(str, args), ...);
+
+    return str;
 }
 
 ///-----------------------------------------------------------------------------
@@ -215,21 +368,26 @@ std::string Format(const std::string &str, Args ...args)
 {
     using namespace Private_Format;
 
-    //COWTODO(n2omatt): Performance is trash here because we're allocating
-    // and release memory everytime that we do a format.
-    // This works for now, but I need research a little further to learn
-    // how to make this better.
-    char *buf = nullptr;
     if(sizeof...(args) == 0)
         return str;
 
-	// COWTODO(n2omatt): asprintf isn't standard...
-    insanecoding::asprintf(&buf, str.c_str(), Argument(args) ...);
+    // Formats on a pooled buffer, so the returned string is the only
+    // allocation (the buffer grows only when a result doesn't fit).
+    Private_Scratch::ScratchString scratch;
+    auto &buffer = *scratch;
+    buffer.resize(std::max(buffer.capacity(), size_t(256)));
 
-    std::string ret_str(buf);
-    free(buf);
+    auto size = std::snprintf(&buffer[0], buffer.size() + 1, str.c_str(), Argument(args)...);
+    if(size < 0)
+        return std::string();
 
-    return ret_str;
+    if(size_t(size) > buffer.size())
+    {
+        buffer.resize(size);
+        std::snprintf(&buffer[0], buffer.size() + 1, str.c_str(), Argument(args)...);
+    }
+
+    return std::string(buffer.data(), size);
 }
 
 
@@ -286,7 +444,7 @@ size_t IndexOfAny(
 ///-----------------------------------------------------------------------------
 /// @brief
 ///   Indicates whether a specified string is null, empty, or consists only
-///   of white-space characters.
+///   of white-space characters (the kWhiteSpaceChars).
 /// @param str
 ///   The string that will be queried.
 /// @returns
@@ -307,22 +465,29 @@ bool IsNullOrWhiteSpace(const std::string &str);
 template <typename T, typename... Args>
 std::string Join(const std::string &separator, const T &first,  Args... args)
 {
-    using namespace Private_Join;
-    return Join(separator, first) + Join(separator, args...);
+    using namespace Private_Concat;
+
+    auto str = std::string();
+    AppendTo(str, first);
+    ((str.append(separator), AppendTo(str, args)), ...);
+
+    return str;
 }
 
 template <typename Container>
 std::string Join(
-    const std::string &separator, 
+    const std::string &separator,
     const Container   &container) noexcept
 {
-    std::stringstream ss;
+    using namespace Private_Concat;
+
+    auto str = std::string();
     for(auto it = std::begin(container); it != std::end(container);) {
-        ss << (*it);
-        if(++it != std::end(container)) 
-            ss << separator;
+        AppendTo(str, *it);
+        if(++it != std::end(container))
+            str.append(separator);
     }
-    return ss.str();
+    return str;
 }
 
 
@@ -390,6 +555,26 @@ size_t LastIndexOfAny(
 ///   nothing will ocurr and the str will be returned as is instead.
 std::string PadLeft(const std::string &str, size_t length, char c = ' ');
 
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as PadLeft but appends the result to out instead of returning
+///   a new string, so the same buffer can be reused between calls.
+void PadLeftTo(std::string &out, std::string_view str, size_t length, char c = ' ');
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as PadLeftTo but writes the result to a output iterator.
+/// @returns
+///   The iterator past the last written char.
+template <typename OutputIt>
+OutputIt PadLeftTo(OutputIt out, std::string_view str, size_t length, char c = ' ')
+{
+    if(str.size() < length)
+        out = std::fill_n(out, length - str.size(), c);
+
+    return std::copy(std::begin(str), std::end(str), out);
+}
+
 
 ///-----------------------------------------------------------------------------
 /// @brief
@@ -409,6 +594,27 @@ std::string PadLeft(const std::string &str, size_t length, char c = ' ');
 ///   nothing will ocurr and the str will be returned as is instead.
 std::string PadRight(const std::string &str, size_t length, char c = ' ');
 
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as PadRight but appends the result to out instead of returning
+///   a new string, so the same buffer can be reused between calls.
+void PadRightTo(std::string &out, std::string_view str, size_t length, char c = ' ');
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as PadRightTo but writes the result to a output iterator.
+/// @returns
+///   The iterator past the last written char.
+template <typename OutputIt>
+OutputIt PadRightTo(OutputIt out, std::string_view str, size_t length, char c = ' ')
+{
+    out = std::copy(std::begin(str), std::end(str), out);
+    if(str.size() < length)
+        out = std::fill_n(out, length - str.size(), c);
+
+    return out;
+}
+
 
 ///-----------------------------------------------------------------------------
 /// @brief
@@ -428,6 +634,45 @@ std::string Replace(
     const std::string &what,
     const std::string &to);
 
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as Replace but appends the result to out instead of returning
+///   a new string, so the same buffer can be reused between calls.
+void ReplaceTo(
+    std::string      &out,
+    std::string_view  str,
+    std::string_view  what,
+    std::string_view  to);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as ReplaceTo but writes the result to a output iterator.
+/// @returns
+///   The iterator past the last written char.
+template <typename OutputIt>
+OutputIt ReplaceTo(
+    OutputIt          out,
+    std::string_view  str,
+    std::string_view  what,
+    std::string_view  to)
+{
+    if(what.empty())
+        return std::copy(std::begin(str), std::end(str), out);
+
+    auto index = size_t(0);
+    while(true)
+    {
+        auto found = str.find(what, index);
+        if(found == std::string_view::npos)
+            break;
+
+        out   = std::copy(str.data() + index, str.data() + found, out);
+        out   = std::copy(std::begin(to), std::end(to), out);
+        index = found + what.size();
+    }
+    return std::copy(std::begin(str) + index, std::end(str), out);
+}
+
 
 ///-----------------------------------------------------------------------------
 /// @brief
@@ -471,12 +716,56 @@ bool StartsWith(
 ///   Returns a copy of this string converted to lowercase.
 std::string ToLower(const std::string &str);
 
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as ToLower but appends the result to out instead of returning
+///   a new string, so the same buffer can be reused between calls.
+void ToLowerTo(std::string &out, std::string_view str);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as ToLowerTo but writes the result to a output iterator.
+/// @returns
+///   The iterator past the last written char.
+template <typename OutputIt>
+OutputIt ToLowerTo(OutputIt out, std::string_view str)
+{
+    return std::transform(
+        std::begin(str),
+        std::end  (str),
+        out,
+        Private_Case::ToLower
+    );
+}
+
 
 ///-----------------------------------------------------------------------------
 /// @brief
 ///   Returns a copy of this string converted to uppercase.
 std::string ToUpper(const std::string &str);
 
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as ToUpper but appends the result to out instead of returning
+///   a new string, so the same buffer can be reused between calls.
+void ToUpperTo(std::string &out, std::string_view str);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as ToUpperTo but writes the result to a output iterator.
+/// @returns
+///   The iterator past the last written char.
+template <typename OutputIt>
+OutputIt ToUpperTo(OutputIt out, std::string_view str)
+{
+    return std::transform(
+        std::begin(str),
+        std::end  (str),
+        out,
+        Private_Case::ToUpper
+    );
+}
+
 
 ///-----------------------------------------------------------------------------
 /// @brief
@@ -485,10 +774,40 @@ std::string ToUpper(const std::string &str);
 /// @param str
 ///   The string that will be trimmed.
 /// @param chars
-///   The char array (as a string) that will be trimmed (Default = " " [space]).
+///   The char array (as a string) that will be trimmed (Default = kWhiteSpaceChars).
 /// @returns
 ///   The string without any chars at both ends.
-std::string Trim(const std::string &str, const std::string &chars = " ");
+std::string Trim(
+    const std::string &str,
+    const std::string &chars = kWhiteSpaceChars);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as Trim but appends the result to out instead of returning
+///   a new string, so the same buffer can be reused between calls.
+void TrimTo(
+    std::string      &out,
+    std::string_view  str,
+    std::string_view  chars = kWhiteSpaceChars);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as TrimTo but writes the result to a output iterator.
+/// @returns
+///   The iterator past the last written char.
+template <typename OutputIt>
+OutputIt TrimTo(
+    OutputIt         out,
+    std::string_view str,
+    std::string_view chars = kWhiteSpaceChars)
+{
+    auto begin = Private_WhiteSpace::FindFirstNotOf(str, chars);
+    if(begin == std::string_view::npos)
+        return out;
+
+    auto end = Private_WhiteSpace::FindLastNotOf(str, chars);
+    return std::copy(str.data() + begin, str.data() + end + 1, out);
+}
 
 
 ///-----------------------------------------------------------------------------
@@ -498,10 +817,39 @@ std::string Trim(const std::string &str, const std::string &chars = " ");
 /// @param str
 ///   The string that will be trimmed.
 /// @param chars
-///   The char array (as a string) that will be trimmed (Default = " " [space]).
+///   The char array (as a string) that will be trimmed (Default = kWhiteSpaceChars).
 /// @returns
 ///   The string without any chars at end.
-std::string TrimEnd(const std::string &str, const std::string &chars = " ");
+std::string TrimEnd(
+    const std::string &str,
+    const std::string &chars = kWhiteSpaceChars);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as TrimEnd but appends the result to out instead of returning
+///   a new string, so the same buffer can be reused between calls.
+void TrimEndTo(
+    std::string      &out,
+    std::string_view  str,
+    std::string_view  chars = kWhiteSpaceChars);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as TrimEndTo but writes the result to a output iterator.
+/// @returns
+///   The iterator past the last written char.
+template <typename OutputIt>
+OutputIt TrimEndTo(
+    OutputIt         out,
+    std::string_view str,
+    std::string_view chars = kWhiteSpaceChars)
+{
+    auto end = Private_WhiteSpace::FindLastNotOf(str, chars);
+    if(end == std::string_view::npos)
+        return out;
+
+    return std::copy(str.data(), str.data() + end + 1, out);
+}
 
 
 ///-----------------------------------------------------------------------------
@@ -511,10 +859,46 @@ std::string TrimEnd(const std::string &str, const std::string &chars = " ");
 /// @param str
 ///   The string that will be trimmed.
 /// @param chars
-///   The char array (as a string) that will be trimmed (Default = " " [space]).
+///   The char array (as a string) that will be trimmed (Default = kWhiteSpaceChars).
 /// @returns
 ///   The string without any chars at beginning.
-std::string TrimStart(const std::string &str, const std::string &chars = " ");
+std::string TrimStart(
+    const std::string &str,
+    const std::string &chars = kWhiteSpaceChars);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as TrimStart but appends the result to out instead of returning
+///   a new string, so the same buffer can be reused between calls.
+void TrimStartTo(
+    std::string      &out,
+    std::string_view  str,
+    std::string_view  chars = kWhiteSpaceChars);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as TrimStartTo but writes the result to a output iterator.
+/// @returns
+///   The iterator past the last written char.
+template <typename OutputIt>
+OutputIt TrimStartTo(
+    OutputIt         out,
+    std::string_view str,
+    std::string_view chars = kWhiteSpaceChars)
+{
+    auto begin = Private_WhiteSpace::FindFirstNotOf(str, chars);
+    if(begin == std::string_view::npos)
+        return out;
+
+    return std::copy(std::begin(str) + begin, std::end(str), out);
+}
 
 
 NS_CORESTRING_END
+
+
+//------------------------------------------------------------------------------
+// Header only - see CORESTRING_INLINE.
+#if defined(CORESTRING_HEADER_ONLY)
+    #include "../src/CoreString.cpp"
+#endif
@@ -0,0 +1,126 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <string_view>
+// CoreString
+#include "CoreString_Utils.h"
+
+NS_CORESTRING_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns true if both strings are equal ignoring the case
+///   of the ASCII letters. No copy of the strings is made.
+bool EqualsIgnoreCase(std::string_view lhs, std::string_view rhs) noexcept;
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Compares both strings ignoring the case of the ASCII letters.
+/// @returns
+///   A negative number if lhs comes before rhs, zero if they are
+///   equal and a positive number if lhs comes after rhs.
+int CompareIgnoreCase(std::string_view lhs, std::string_view rhs) noexcept;
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Hash of the string with its ASCII letters lowercased, so strings
+///   that are EqualsIgnoreCase have the same hash.
+size_t HashIgnoreCase(std::string_view str) noexcept;
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as EqualsIgnoreCase but for UTF-8 strings, folding the case of
+///   the Latin-1, Latin Extended-A, Greek and Cyrillic letters as well.
+/// @note
+///   Only the foldings that keep the UTF-8 length of the char are applied
+///   (so 'ſ' and the Kelvin sign aren't folded), which lets the ASCII runs
+///   be handled with the same vectorized code of the ASCII versions.
+///   Invalid UTF-8 sequences are compared byte by byte.
+bool EqualsIgnoreCaseUtf8(std::string_view lhs, std::string_view rhs) noexcept;
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as CompareIgnoreCase but for UTF-8 strings.
+///   The folded code points are compared.
+/// @see EqualsIgnoreCaseUtf8.
+int CompareIgnoreCaseUtf8(std::string_view lhs, std::string_view rhs) noexcept;
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as HashIgnoreCase but for UTF-8 strings.
+/// @see EqualsIgnoreCaseUtf8.
+size_t HashIgnoreCaseUtf8(std::string_view str) noexcept;
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Functors to use case insensitive keys on the std containers, e.g:
+///     std::unordered_map<std::string, T, CaseInsensitiveHash, CaseInsensitiveEqual>
+///     std::map<std::string, T, CaseInsensitiveLess>
+///   All of them are transparent, so the lookups can be done with a
+///   std::string_view (or a string literal) without creating a std::string.
+/// @note
+///   Heterogeneous lookup in the unordered containers needs C++20,
+///   the ordered ones already support it.
+struct CaseInsensitiveHash
+{
+    typedef void is_transparent;
+    size_t operator()(std::string_view str) const noexcept
+    {
+        return HashIgnoreCase(str);
+    }
+};
+
+struct CaseInsensitiveEqual
+{
+    typedef void is_transparent;
+    bool operator()(std::string_view lhs, std::string_view rhs) const noexcept
+    {
+        return EqualsIgnoreCase(lhs, rhs);
+    }
+};
+
+struct CaseInsensitiveLess
+{
+    typedef void is_transparent;
+    bool operator()(std::string_view lhs, std::string_view rhs) const noexcept
+    {
+        return CompareIgnoreCase(lhs, rhs) < 0;
+    }
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as the CaseInsensitive functors but for UTF-8 strings.
+/// @see EqualsIgnoreCaseUtf8.
+struct CaseInsensitiveHashUtf8
+{
+    typedef void is_transparent;
+    size_t operator()(std::string_view str) const noexcept
+    {
+        return HashIgnoreCaseUtf8(str);
+    }
+};
+
+struct CaseInsensitiveEqualUtf8
+{
+    typedef void is_transparent;
+    bool operator()(std::string_view lhs, std::string_view rhs) const noexcept
+    {
+        return EqualsIgnoreCaseUtf8(lhs, rhs);
+    }
+};
+
+struct CaseInsensitiveLessUtf8
+{
+    typedef void is_transparent;
+    bool operator()(std::string_view lhs, std::string_view rhs) const noexcept
+    {
+        return CompareIgnoreCaseUtf8(lhs, rhs) < 0;
+    }
+};
+
+NS_CORESTRING_END
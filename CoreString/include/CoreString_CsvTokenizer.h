@@ -0,0 +1,98 @@
+#pragma once
+
+// std
+#include <string>
+#include <string_view>
+#include <vector>
+// CoreString
+#include "CoreString_Utils.h"
+
+NS_CORESTRING_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Splits delimited text (CSV, TSV...) into records and fields.
+///   Fields may be enclosed in quotes, so they can have delimiters and
+///   line breaks in them, and a quote inside a quoted field is written
+///   as two quotes. Records end at '\n' (or "\r\n").
+///
+///   The structural chars are found 64 bytes at time: the quotes, the
+///   delimiters and the line breaks become bit masks and a prefix xor of
+///   the quotes tells which bytes are inside a quoted field.
+/// @note
+///   The fields are views to the input, only fields with escaped quotes
+///   are copied (unescaped) to an internal buffer - so the fields are
+///   valid until the next call of NextRecord.
+/// @example
+///   CsvTokenizer tokenizer(text);
+///   std::vector<std::string_view> fields;
+///   while(tokenizer.NextRecord(fields))
+///       ...
+class CsvTokenizer
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @param input
+    ///   The text that will be tokenized. It must outlive the tokenizer.
+    /// @param delimiter
+    ///   The fields separator (Default: ',' - use '\t' for TSV).
+    /// @param quote
+    ///   The char used to enclose the fields (Default: '"').
+    explicit CsvTokenizer(
+        std::string_view input,
+        char             delimiter = ',',
+        char             quote     = '"');
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Reads the next record.
+    /// @param fields
+    ///   Receives the record's fields (its previous contents are cleared).
+    /// @returns
+    ///   False if there's no more records, true otherwise.
+    bool NextRecord(std::vector<std::string_view> &fields);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Offset of the input where the next record starts.
+    size_t Position() const noexcept { return m_position; }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void AddField(size_t begin, size_t end, bool endsLine);
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    // Where each field of the current record is, either on the
+    // input or on the unescape buffer.
+    struct Span
+    {
+        size_t offset;
+        size_t size;
+        bool   unescaped;
+    };
+
+    std::string_view  m_input;
+    char              m_delimiter;
+    char              m_quote;
+    size_t            m_position;
+
+    std::vector<Span> m_spans;
+    std::string       m_unescapeBuffer;
+};
+
+NS_CORESTRING_END
@@ -0,0 +1,65 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <string>
+#include <string_view>
+// CoreString
+#include "CoreString_Utils.h"
+
+NS_CORESTRING_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns the Levenshtein distance between lhs and rhs - the minimum
+///   number of chars that must be inserted, deleted or replaced to turn
+///   one string into the other.
+///   It uses the Myers/Hyyro bit-parallel algorithm, processing 64 chars of
+///   the shortest string at once for each char of the other string.
+/// @param maxDistance
+///   Stops as soon as the distance is known to be greater than it
+///   (Default: std::string::npos - compute the exact distance).
+/// @returns
+///   The distance, or maxDistance + 1 if it's greater than maxDistance.
+/// @note
+///   Nothing is allocated if the shortest string has up to 64 chars.
+size_t EditDistance(
+    std::string_view lhs,
+    std::string_view rhs,
+    size_t           maxDistance = std::string::npos);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as EditDistance but transposing two adjacent chars costs one
+///   edit as well (the optimal string alignment / restricted Damerau
+///   distance - a substring is never edited more than once).
+/// @see EditDistance.
+size_t DamerauDistance(
+    std::string_view lhs,
+    std::string_view rhs,
+    size_t           maxDistance = std::string::npos);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Finds the first substring of haystack that is at most maxErrors
+///   edits (Levenshtein) away from needle.
+/// @returns
+///   The index one past the end of the match (the algorithm finds where
+///   the matches end) or std::string::npos if there's no match.
+/// @see EditDistance.
+size_t FuzzyFind(
+    std::string_view haystack,
+    std::string_view needle,
+    size_t           maxErrors);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns true if haystack has a substring that is at most
+///   maxErrors edits (Levenshtein) away from needle.
+/// @see FuzzyFind.
+bool FuzzyContains(
+    std::string_view haystack,
+    std::string_view needle,
+    size_t           maxErrors);
+
+NS_CORESTRING_END
@@ -0,0 +1,112 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <string>
+#include <string_view>
+// CoreString
+#include "CoreString_Utils.h"
+
+NS_CORESTRING_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   The Base64 alphabets (RFC 4648). They differ only in the chars of
+///   the values 62 and 63: "+/" for Standard and "-_" for Url.
+enum class Base64Variant
+{
+    Standard,
+    Url
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns the size of the Base64 encoding of size bytes.
+/// @param padding
+///   If the encoding is padded with '=' to a multiple of 4 chars.
+constexpr size_t Base64EncodedSize(size_t size, bool padding = true) noexcept
+{
+    return (padding) ? (size + 2) / 3 * 4 : (size * 4 + 2) / 3;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns the Base64 encoding of data.
+///   With SSSE3 (or AVX2) 12 (or 24) bytes are encoded at time, the
+///   other builds use a scalar fallback.
+/// @param variant
+///   The alphabet (Default: Base64Variant::Standard).
+/// @param padding
+///   If the result is padded with '=' to a multiple of 4 chars
+///   (Default: true).
+std::string EncodeBase64(
+    std::string_view data,
+    Base64Variant    variant = Base64Variant::Standard,
+    bool             padding = true);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as EncodeBase64 but appends the result to out instead of
+///   returning a new string, so the same buffer can be reused between calls.
+void EncodeBase64To(
+    std::string      &out,
+    std::string_view  data,
+    Base64Variant     variant = Base64Variant::Standard,
+    bool              padding = true);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Decodes Base64 text, padded or not, appending the bytes to out.
+///   The decoding is strict: any char out of the alphabet (whitespace
+///   included), misplaced padding, a size that isn't possible or unused
+///   bits that aren't zero make it fail.
+///   The chars are validated and translated 16 (or 32 with AVX2) at time.
+/// @returns
+///   True if str is valid - otherwise out is left as it was.
+bool DecodeBase64To(
+    std::string      &out,
+    std::string_view  str,
+    Base64Variant     variant = Base64Variant::Standard);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns the bytes of the Base64 text, or an empty string if it
+///   isn't valid (use DecodeBase64To to tell it from an empty input).
+/// @see DecodeBase64To.
+std::string DecodeBase64(
+    std::string_view str,
+    Base64Variant    variant = Base64Variant::Standard);
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns the hexadecimal encoding of data (two digits for each byte).
+///   16 (or 32 with AVX2) bytes are encoded at time.
+/// @param uppercase
+///   If the digits above 9 are 'A'...'F' instead of 'a'...'f'
+///   (Default: false).
+std::string EncodeHex(std::string_view data, bool uppercase = false);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as EncodeHex but appends the result to out instead of returning
+///   a new string, so the same buffer can be reused between calls.
+void EncodeHexTo(std::string &out, std::string_view data, bool uppercase = false);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Decodes hexadecimal text (digits of any case), appending the bytes
+///   to out. Fails on odd sizes and on anything that isn't a digit.
+/// @returns
+///   True if str is valid - otherwise out is left as it was.
+bool DecodeHexTo(std::string &out, std::string_view str);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns the bytes of the hexadecimal text, or an empty string if it
+///   isn't valid (use DecodeHexTo to tell it from an empty input).
+/// @see DecodeHexTo.
+std::string DecodeHex(std::string_view str);
+
+NS_CORESTRING_END
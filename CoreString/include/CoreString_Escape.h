@@ -0,0 +1,72 @@
+#pragma once
+
+// std
+#include <string>
+#include <string_view>
+// CoreString
+#include "CoreString_Utils.h"
+
+NS_CORESTRING_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   The escaping rules known by Escape and Unescape.
+enum class EscapeFormat
+{
+    ///-------------------------------------------------------------------------
+    /// '"', '\' and the control chars (as \n, \t... or \u00XX).
+    /// Unescape decodes \uXXXX (surrogate pairs included) to UTF-8.
+    Json,
+
+    ///-------------------------------------------------------------------------
+    /// '&', '<', '>', '"' and '\'' as entities.
+    /// Unescape knows those five (and &apos;) plus the numeric ones
+    /// (&#NNN; and &#xHHHH;) - the other named entities are kept.
+    Html,
+
+    ///-------------------------------------------------------------------------
+    /// Percent encoding of everything but the RFC 3986 unreserved chars
+    /// (letters, digits and "-_.~").
+    Url,
+
+    ///-------------------------------------------------------------------------
+    /// C literal: '\', '"', '\'' and the control chars as \n, \t... and
+    /// the other non printable bytes as octal (\ooo). Unescape knows the
+    /// hex (\xHH), \uXXXX and \UXXXXXXXX escapes too.
+    C
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns str with the chars that are special in the format escaped.
+///   The runs of chars that don't need escaping are skipped 16 bytes at
+///   time (SSE2) and the size of the result is computed before anything
+///   is written, so the output is allocated only once.
+std::string Escape(std::string_view str, EscapeFormat format);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as Escape but appends the result to out instead of returning
+///   a new string, so the same buffer can be reused between calls.
+void EscapeTo(std::string &out, std::string_view str, EscapeFormat format);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns the size that Escape would return, without escaping.
+size_t EscapedSize(std::string_view str, EscapeFormat format) noexcept;
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Reverts Escape. Malformed or unknown escape sequences are kept as
+///   they are, so any string can be unescaped.
+std::string Unescape(std::string_view str, EscapeFormat format);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as Unescape but appends the result to out instead of returning
+///   a new string, so the same buffer can be reused between calls.
+void UnescapeTo(std::string &out, std::string_view str, EscapeFormat format);
+
+NS_CORESTRING_END
@@ -0,0 +1,165 @@
+#pragma once
+
+// std
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+// CoreString
+#include "CoreString_Utils.h"
+#include "CoreString.h"
+
+NS_CORESTRING_BEGIN
+
+namespace Private_FormatTemplate
+{
+    //--------------------------------------------------------------------------
+    // Type erased reference to an argument of Render.
+    struct ArgRef
+    {
+        std::string_view  name; // Empty for the positional ones.
+        const void       *value;
+        void            (*append)(std::string &out, const void *value);
+    };
+
+    template <typename T>
+    void AppendArg(std::string &out, const void *value)
+    {
+        Private_Concat::AppendTo(out, *static_cast<const T *>(value));
+    }
+
+    template <typename T>
+    struct NamedArg
+    {
+        std::string_view  name;
+        const T          &value;
+    };
+
+    template <typename T>
+    ArgRef MakeRef(const T &value) noexcept
+    {
+        return ArgRef{ std::string_view(), &value, &AppendArg<T> };
+    }
+
+    template <typename T>
+    ArgRef MakeRef(const NamedArg<T> &arg) noexcept
+    {
+        return ArgRef{ arg.name, &arg.value, &AppendArg<T> };
+    }
+}
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Names an argument of FormatTemplate::Render, e.g:
+///     tmpl.Render(CoreString::Arg("user", name), CoreString::Arg("id", 42));
+/// @note
+///   It keeps a reference to value, so use it only in the Render call.
+template <typename T>
+Private_FormatTemplate::NamedArg<T> Arg(std::string_view name, const T &value) noexcept
+{
+    return Private_FormatTemplate::NamedArg<T>{ name, value };
+}
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Format string parsed once to be rendered many times.
+///   The slots are written between braces:
+///     {}       - The argument at the slot's position (the n-th slot).
+///     {1}      - The argument at that position (named ones included).
+///     {name}   - The argument named with CoreString::Arg.
+///   Followed by an optional spec, after a ':', of [[fill]align][width]:
+///     {:>8}    - Padded on the left to 8 chars, as PadLeft.
+///     {:<8}    - Padded on the right to 8 chars, as PadRight (default).
+///     {:*^8}   - Centered with '*', as Center.
+///   "{{" and "}}" are literal braces.
+///
+///   The template becomes a list of literal and slot ops, so rendering is
+///   only appending the literals (their sizes are already known) and the
+///   arguments - which are converted as in Concat.
+/// @note
+///   A malformed template (unmatched braces or bad specs) is kept as
+///   literal text from the error on, and IsValid returns false.
+class FormatTemplate
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    explicit FormatTemplate(std::string_view format);
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Renders the template with the arguments.
+    template <typename ...Args>
+    std::string Render(const Args &...args) const
+    {
+        auto str = std::string();
+        RenderTo(str, args...);
+        return str;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Same as Render but appends the result to out, so the same
+    ///   buffer can be reused between calls.
+    template <typename ...Args>
+    void RenderTo(std::string &out, const Args &...args) const
+    {
+        using namespace Private_FormatTemplate;
+
+        const std::array<ArgRef, sizeof...(Args)> refs = { MakeRef(args)... };
+        RenderRefs(out, refs.data(), refs.size());
+    }
+
+    bool   IsValid   () const noexcept { return m_valid;      }
+    size_t SlotsCount() const noexcept { return m_slotsCount; }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void AddLiteral(std::string_view text);
+    bool AddSlot   (std::string_view field, std::string_view spec);
+
+    void RenderRefs(
+        std::string                          &out,
+        const Private_FormatTemplate::ArgRef *args,
+        size_t                                argsCount) const;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    enum class OpType : uint8_t { Literal, Index, Name };
+    enum class Align  : uint8_t { Left, Right, Center };
+
+    struct Op
+    {
+        OpType   type;
+        Align    align;
+        char     fill;
+        uint32_t width;
+        uint32_t index;  // Of the argument (OpType::Index).
+        uint32_t offset; // On m_text, of the literal or name.
+        uint32_t size;
+    };
+
+    std::string     m_text; // The literals and the names.
+    std::vector<Op> m_ops;
+
+    size_t m_literalsSize;
+    size_t m_slotsCount;
+    bool   m_valid;
+};
+
+NS_CORESTRING_END
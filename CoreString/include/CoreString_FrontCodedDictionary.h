@@ -0,0 +1,195 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+// CoreString
+#include "CoreString_Utils.h"
+
+NS_CORESTRING_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns how many chars at the start of both strings are equal.
+///   They're compared 16 bytes at time (32 with AVX2).
+size_t CommonPrefixLength(std::string_view lhs, std::string_view rhs) noexcept;
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Immutable sorted set of strings stored front coded: the strings are
+///   grouped in buckets, the first one of each bucket (its head) is kept
+///   whole and each of the others as the size of the prefix it shares
+///   with the previous one plus the rest of it.
+///   Sorted keys usually share long prefixes (paths, URLs, identifiers...),
+///   so this takes a fraction of the memory of a std::vector<std::string>
+///   and all of it is in a single buffer.
+///
+///   The lookups binary search the heads and then walk a single bucket,
+///   comparing the key against the coded strings without decoding them.
+/// @note
+///   The strings must be given already sorted (as std::string's operator <).
+/// @see FrontCodedIterator to decode them in order.
+class FrontCodedDictionary
+{
+    //------------------------------------------------------------------------//
+    // Types                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    static constexpr size_t kDefaultBucketSize = 16;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Creates an empty dictionary.
+    FrontCodedDictionary() noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @param sortedStrings
+    ///   The strings that will be stored, sorted.
+    /// @param bucketSize
+    ///   How many strings each bucket has - bigger ones take less memory
+    ///   but make the lookups walk more (Default: kDefaultBucketSize).
+    explicit FrontCodedDictionary(
+        const std::vector<std::string> &sortedStrings,
+        size_t                          bucketSize = kDefaultBucketSize);
+
+    explicit FrontCodedDictionary(
+        const std::vector<std::string_view> &sortedStrings,
+        size_t                               bucketSize = kDefaultBucketSize);
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the index of key or std::string::npos if it isn't stored.
+    size_t Find(std::string_view key) const noexcept;
+
+    bool Contains(std::string_view key) const noexcept
+    {
+        return Find(key) != std::string::npos;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the index of the first string that isn't less than key,
+    ///   Size() if there's none.
+    size_t LowerBound(std::string_view key) const noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the [first, last) range of the indexes of the strings
+    ///   that start with prefix - an empty one if there's none.
+    std::pair<size_t, size_t> PrefixRange(std::string_view prefix) const noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Decodes the string at index.
+    std::string At(size_t index) const;
+
+    size_t Size () const noexcept { return m_size;      }
+    bool   Empty() const noexcept { return m_size == 0; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Bytes used by the coded strings and the buckets' offsets.
+    size_t MemoryBytes() const noexcept
+    {
+        return m_data.size() + m_bucketsOffsets.size() * sizeof(size_t);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void Append(std::string_view str, std::string_view previous);
+
+    std::string_view Head(size_t bucket) const noexcept;
+
+    // Index of the first string that comes after key - in the prefix
+    // mode the strings that start with key don't.
+    size_t Search(std::string_view key, bool prefixMode, bool &found) const noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    friend class FrontCodedIterator; // Walks m_data.
+
+    // Heads: varint size + chars.
+    // Others: varint shared prefix size + varint suffix size + suffix chars.
+    std::string         m_data;
+    std::vector<size_t> m_bucketsOffsets;
+
+    size_t m_bucketSize;
+    size_t m_size;
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Decodes the strings of a FrontCodedDictionary in order, each one
+///   from the previous - so it's much cheaper than calling At.
+/// @note
+///   The dictionary must outlive the iterator, and the strings it gives
+///   are valid only until the next call.
+/// @example
+///   FrontCodedIterator it(dictionary);
+///   std::string_view str;
+///   while(it.Next(str))
+///       ...
+class FrontCodedIterator
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @param index
+    ///   Index of the first string that will be given (Default: 0).
+    explicit FrontCodedIterator(
+        const FrontCodedDictionary &dictionary,
+        size_t                      index = 0);
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Decodes the next string.
+    /// @returns
+    ///   False if there's no more strings, true otherwise.
+    bool Next(std::string_view &str);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Index of the string that the next call will give.
+    size_t Index() const noexcept { return m_index; }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    const FrontCodedDictionary *m_pDictionary;
+
+    std::string m_current;
+    size_t      m_offset; // On the dictionary's data, of the next string.
+    size_t      m_index;
+};
+
+NS_CORESTRING_END
@@ -0,0 +1,318 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+// CoreString
+#include "CoreString_Utils.h"
+#include "CoreString_WhiteSpace.h"
+
+NS_CORESTRING_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Trim, Split, StartsWith, EndsWith and Replace for the strings of any
+///   char type - std::u16string, std::u32string, std::wstring (and
+///   std::u8string on C++20).
+///
+///   They're templates over the char type, that the compiler only picks
+///   when the std::string functions of CoreString.h can't take the
+///   arguments. The scans go through vectorized kernels chosen by the
+///   size of the char: the 1 byte ones use the kernels of std::string,
+///   the 2 and 4 bytes ones compare 8 or 4 chars at time.
+/// @note
+///   The white-spaces are the kWhiteSpaceChars and the case-insensitive
+///   compares only fold the ASCII letters, as with std::string.
+
+namespace Private_Generic
+{
+    //--------------------------------------------------------------------------
+    // Index of the first / last char of str that is (or isn't, if !inSet)
+    // one of the chars of set, or npos - over the bytes, so any char type
+    // of that size can use them.
+    //   A null set is the kWhiteSpaceChars.
+    size_t FindFirst2(const void *str, size_t size, const void *set, size_t setSize, bool inSet) noexcept;
+    size_t FindLast2 (const void *str, size_t size, const void *set, size_t setSize, bool inSet) noexcept;
+    size_t FindFirst4(const void *str, size_t size, const void *set, size_t setSize, bool inSet) noexcept;
+    size_t FindLast4 (const void *str, size_t size, const void *set, size_t setSize, bool inSet) noexcept;
+
+    //--------------------------------------------------------------------------
+    template <typename CharT>
+    size_t FindFirst(
+        std::basic_string_view<CharT> str,
+        const CharT                  *set,
+        size_t                        setSize,
+        bool                          inSet) noexcept
+    {
+        static_assert(
+            sizeof(CharT) == 1 || sizeof(CharT) == 2 || sizeof(CharT) == 4,
+            "CoreString only supports chars of 1, 2 or 4 bytes"
+        );
+
+        if constexpr(sizeof(CharT) == 1)
+        {
+            auto view  = std::string_view(reinterpret_cast<const char *>(str.data()), str.size());
+            auto chars = (set)
+                ? std::string_view(reinterpret_cast<const char *>(set), setSize)
+                : std::string_view(kWhiteSpaceChars);
+
+            if(!inSet)
+                return Private_WhiteSpace::FindFirstNotOf(view, chars);
+            if(chars.size() == 1)
+                return view.find(chars[0]);
+            return view.find_first_of(chars);
+        }
+        else if constexpr(sizeof(CharT) == 2)
+        {
+            return FindFirst2(str.data(), str.size(), set, setSize, inSet);
+        }
+        else
+        {
+            return FindFirst4(str.data(), str.size(), set, setSize, inSet);
+        }
+    }
+
+    template <typename CharT>
+    size_t FindLast(
+        std::basic_string_view<CharT> str,
+        const CharT                  *set,
+        size_t                        setSize,
+        bool                          inSet) noexcept
+    {
+        if constexpr(sizeof(CharT) == 1)
+        {
+            auto view  = std::string_view(reinterpret_cast<const char *>(str.data()), str.size());
+            auto chars = (set)
+                ? std::string_view(reinterpret_cast<const char *>(set), setSize)
+                : std::string_view(kWhiteSpaceChars);
+
+            return (inSet)
+                ? view.find_last_of(chars)
+                : Private_WhiteSpace::FindLastNotOf(view, chars);
+        }
+        else if constexpr(sizeof(CharT) == 2)
+        {
+            return FindLast2(str.data(), str.size(), set, setSize, inSet);
+        }
+        else
+        {
+            return FindLast4(str.data(), str.size(), set, setSize, inSet);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Index of needle on str, from index - its first char is found by the
+    // kernels and the rest is compared as bytes.
+    template <typename CharT>
+    size_t Find(
+        std::basic_string_view<CharT> str,
+        std::basic_string_view<CharT> needle,
+        size_t                        index) noexcept
+    {
+        while(index + needle.size() <= str.size())
+        {
+            auto found = FindFirst(str.substr(index), needle.data(), 1, true);
+            if(found == std::basic_string_view<CharT>::npos)
+                break;
+
+            index += found;
+            if(index + needle.size() > str.size())
+                break;
+
+            if(std::memcmp(str.data() + index, needle.data(), needle.size() * sizeof(CharT)) == 0)
+                return index;
+
+            ++index;
+        }
+
+        return std::basic_string_view<CharT>::npos;
+    }
+
+    //--------------------------------------------------------------------------
+    template <typename CharT>
+    std::basic_string<CharT> Trim(
+        std::basic_string_view<CharT> str,
+        const CharT                  *set,
+        size_t                        setSize,
+        bool                          start,
+        bool                          end)
+    {
+        auto begin = (start) ? FindFirst(str, set, setSize, false) : size_t(0);
+        if(begin == std::basic_string_view<CharT>::npos || str.empty())
+            return std::basic_string<CharT>();
+
+        auto last = (end) ? FindLast(str, set, setSize, false) : str.size() - 1;
+        return std::basic_string<CharT>(str.substr(begin, last - begin + 1));
+    }
+
+    template <typename CharT>
+    bool EqualAt(
+        std::basic_string_view<CharT> haystack,
+        std::basic_string_view<CharT> needle,
+        size_t                        index,
+        bool                          caseSensitive) noexcept
+    {
+        if(caseSensitive)
+            return std::memcmp(haystack.data() + index, needle.data(), needle.size() * sizeof(CharT)) == 0;
+
+        for(auto i = size_t(0); i < needle.size(); ++i)
+        {
+            auto c1 = haystack[index + i];
+            auto c2 = needle[i];
+            if(c1 >= CharT('A') && c1 <= CharT('Z')) c1 = CharT(c1 + ('a' - 'A'));
+            if(c2 >= CharT('A') && c2 <= CharT('Z')) c2 = CharT(c2 + ('a' - 'A'));
+            if(c1 != c2)
+                return false;
+        }
+
+        return true;
+    }
+}
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Removes the white-spaces / the chars at both ends of str.
+template <typename CharT>
+std::basic_string<CharT> Trim(const std::basic_string<CharT> &str)
+{
+    return Private_Generic::Trim<CharT>(str, nullptr, 0, true, true);
+}
+
+template <typename CharT>
+std::basic_string<CharT> Trim(
+    const std::basic_string<CharT> &str,
+    const std::basic_string<CharT> &chars)
+{
+    return Private_Generic::Trim<CharT>(str, chars.data(), chars.size(), true, true);
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Removes the white-spaces / the chars at the start of str.
+template <typename CharT>
+std::basic_string<CharT> TrimStart(const std::basic_string<CharT> &str)
+{
+    return Private_Generic::Trim<CharT>(str, nullptr, 0, true, false);
+}
+
+template <typename CharT>
+std::basic_string<CharT> TrimStart(
+    const std::basic_string<CharT> &str,
+    const std::basic_string<CharT> &chars)
+{
+    return Private_Generic::Trim<CharT>(str, chars.data(), chars.size(), true, false);
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Removes the white-spaces / the chars at the end of str.
+template <typename CharT>
+std::basic_string<CharT> TrimEnd(const std::basic_string<CharT> &str)
+{
+    return Private_Generic::Trim<CharT>(str, nullptr, 0, false, true);
+}
+
+template <typename CharT>
+std::basic_string<CharT> TrimEnd(
+    const std::basic_string<CharT> &str,
+    const std::basic_string<CharT> &chars)
+{
+    return Private_Generic::Trim<CharT>(str, chars.data(), chars.size(), false, true);
+}
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Splits str on any of the chars, keeping the empty components.
+template <typename CharT>
+std::vector<std::basic_string<CharT>> Split(
+    const std::basic_string<CharT> &str,
+    const std::basic_string<CharT> &chars)
+{
+    auto view = std::basic_string_view<CharT>(str);
+    auto vec  = std::vector<std::basic_string<CharT>>();
+
+    auto index = size_t(0);
+    while(true)
+    {
+        auto found = Private_Generic::FindFirst(view.substr(index), chars.data(), chars.size(), true);
+        if(found == std::basic_string_view<CharT>::npos)
+            break;
+
+        vec.emplace_back(view.substr(index, found));
+        index += found + 1;
+    }
+
+    vec.emplace_back(view.substr(index));
+    return vec;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Same as Split with a char array (as a string) but only with one char.
+template <typename CharT>
+std::vector<std::basic_string<CharT>> Split(const std::basic_string<CharT> &str, CharT c)
+{
+    return Split(str, std::basic_string<CharT>(1, c));
+}
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Determines whether haystack starts / ends with needle.
+template <typename CharT>
+bool StartsWith(
+    const std::basic_string<CharT> &haystack,
+    const std::basic_string<CharT> &needle,
+    bool                            caseSensitive = true)
+{
+    return haystack.size() >= needle.size()
+        && Private_Generic::EqualAt<CharT>(haystack, needle, 0, caseSensitive);
+}
+
+template <typename CharT>
+bool EndsWith(
+    const std::basic_string<CharT> &haystack,
+    const std::basic_string<CharT> &needle,
+    bool                            caseSensitive = true)
+{
+    return haystack.size() >= needle.size()
+        && Private_Generic::EqualAt<CharT>(haystack, needle, haystack.size() - needle.size(), caseSensitive);
+}
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns str with all the occurrences of what replaced by to.
+template <typename CharT>
+std::basic_string<CharT> Replace(
+    const std::basic_string<CharT> &str,
+    const std::basic_string<CharT> &what,
+    const std::basic_string<CharT> &to)
+{
+    if(what.empty())
+        return str;
+
+    auto view = std::basic_string_view<CharT>(str);
+    auto out  = std::basic_string<CharT>();
+    out.reserve(str.size());
+
+    auto index = size_t(0);
+    while(true)
+    {
+        auto found = Private_Generic::Find<CharT>(view, what, index);
+        if(found == std::basic_string_view<CharT>::npos)
+            break;
+
+        out.append(view.substr(index, found - index)).append(to);
+        index = found + what.size();
+    }
+
+    out.append(view.substr(index));
+    return out;
+}
+
+NS_CORESTRING_END
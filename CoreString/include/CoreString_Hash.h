@@ -0,0 +1,145 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+// CoreString
+#include "CoreString_Utils.h"
+
+NS_CORESTRING_BEGIN
+
+namespace Private_Hash
+{
+    constexpr uint64_t kSecret0 = 0xA0761D6478BD642FULL;
+    constexpr uint64_t kSecret1 = 0xE7037ED1A0B428DBULL;
+    constexpr uint64_t kSecret2 = 0x8EBC6AF09C88C6E3ULL;
+
+    //--------------------------------------------------------------------------
+    // Little endian loads written byte by byte, so they can run at compile
+    // time - GCC and Clang turn them into a single load.
+    constexpr uint64_t Read64(const char *p) noexcept
+    {
+        return uint64_t(uint8_t(p[0]))       | uint64_t(uint8_t(p[1])) <<  8 |
+               uint64_t(uint8_t(p[2])) << 16 | uint64_t(uint8_t(p[3])) << 24 |
+               uint64_t(uint8_t(p[4])) << 32 | uint64_t(uint8_t(p[5])) << 40 |
+               uint64_t(uint8_t(p[6])) << 48 | uint64_t(uint8_t(p[7])) << 56;
+    }
+
+    constexpr uint64_t Read32(const char *p) noexcept
+    {
+        return uint64_t(uint8_t(p[0]))       | uint64_t(uint8_t(p[1])) <<  8 |
+               uint64_t(uint8_t(p[2])) << 16 | uint64_t(uint8_t(p[3])) << 24;
+    }
+
+    //--------------------------------------------------------------------------
+    // Full 64x64 -> 128 bits multiplication, folded back to 64 bits.
+    constexpr uint64_t Mum(uint64_t a, uint64_t b) noexcept
+    {
+    #if defined(__SIZEOF_INT128__)
+        auto r = __uint128_t(a) * b;
+        return uint64_t(r) ^ uint64_t(r >> 64);
+    #else
+        auto a_lo = a & 0xFFFFFFFF, a_hi = a >> 32;
+        auto b_lo = b & 0xFFFFFFFF, b_hi = b >> 32;
+
+        auto lo_lo = a_lo * b_lo;
+        auto hi_lo = a_hi * b_lo;
+        auto lo_hi = a_lo * b_hi;
+        auto hi_hi = a_hi * b_hi;
+
+        auto cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+        auto lo    = (cross << 32) | (lo_lo & 0xFFFFFFFF);
+        auto hi    = hi_hi + (hi_lo >> 32) + (cross >> 32);
+        return lo ^ hi;
+    #endif
+    }
+}
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Fast non-cryptographic 64 bits hash of the string (wyhash-like).
+///   The input is read 16 bytes per multiplication, with three independent
+///   lanes for strings longer than 48 bytes so the multiplications run in
+///   parallel, and short strings are handled with overlapping loads.
+/// @note
+///   It's constexpr, so it can hash literals at compile time.
+///   The values are the same in every platform.
+constexpr uint64_t Hash64(std::string_view str, uint64_t seed = 0) noexcept
+{
+    using namespace Private_Hash;
+
+    auto p    = str.data();
+    auto size = str.size();
+
+    seed ^= Mum(seed ^ kSecret0, kSecret1);
+
+    auto a = uint64_t(0);
+    auto b = uint64_t(0);
+    if(size <= 16)
+    {
+        if(size >= 4)
+        {
+            auto step = (size >> 3) << 2;
+            a = (Read32(p) << 32)            | Read32(p + step);
+            b = (Read32(p + size - 4) << 32) | Read32(p + size - 4 - step);
+        }
+        else if(size > 0)
+        {
+            a = (uint64_t(uint8_t(p[0])) << 16) |
+                (uint64_t(uint8_t(p[size >> 1])) << 8) |
+                 uint64_t(uint8_t(p[size - 1]));
+        }
+    }
+    else
+    {
+        auto remaining = size;
+        if(remaining > 48)
+        {
+            auto seed1 = seed;
+            auto seed2 = seed;
+            do {
+                seed  = Mum(Read64(p)      ^ kSecret1, Read64(p +  8) ^ seed);
+                seed1 = Mum(Read64(p + 16) ^ kSecret2, Read64(p + 24) ^ seed1);
+                seed2 = Mum(Read64(p + 32) ^ kSecret0, Read64(p + 40) ^ seed2);
+
+                p         += 48;
+                remaining -= 48;
+            } while(remaining > 48);
+
+            seed ^= seed1 ^ seed2;
+        }
+
+        while(remaining > 16)
+        {
+            seed = Mum(Read64(p) ^ kSecret1, Read64(p + 8) ^ seed);
+
+            p         += 16;
+            remaining -= 16;
+        }
+
+        // The last 16 bytes, overlapping what was already read.
+        a = Read64(p + remaining - 16);
+        b = Read64(p + remaining - 8);
+    }
+
+    return Mum(kSecret1 ^ size, Mum(a ^ kSecret1, b ^ seed));
+}
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Functor to use Hash64 on the std containers - with the transparent
+///   equal_to<> the lookups can take string_views without allocating.
+struct FastHash
+{
+    using is_transparent = void;
+
+    size_t operator()(std::string_view str) const noexcept
+    {
+        return size_t(Hash64(str));
+    }
+};
+
+NS_CORESTRING_END
@@ -0,0 +1,69 @@
+#pragma once
+
+// std
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+// CoreString
+#include "CoreString_Utils.h"
+
+NS_CORESTRING_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   How many times each byte value appears, indexed by the unsigned byte.
+using ByteHistogram = std::array<uint64_t, 256>;
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   The delimiters that DetectDelimiter tries by default:
+///   comma, semicolon, tab, pipe and colon - in order of preference.
+inline constexpr char kDelimiterCandidates[] = ",;\t|:";
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Counts the bytes of str in a single pass.
+///   The counts are spread over four interleaved tables, so runs of the
+///   same byte don't wait on the increment of the previous one.
+/// @param threadsCount
+///   How many threads will count slices of str (Default: 0 - as many as
+///   the hardware has). Small inputs always use only the calling thread.
+ByteHistogram Histogram(std::string_view str, size_t threadsCount = 0);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as Histogram but adds the counts to histogram instead of
+///   returning a new one, so a stream can be counted chunk by chunk.
+void HistogramTo(
+    ByteHistogram    &histogram,
+    std::string_view  str,
+    size_t            threadsCount = 0);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   The Shannon entropy of the bytes counted on histogram, in bits per
+///   byte - from 0 (a single value) to 8 (all values equally likely).
+double Entropy(const ByteHistogram &histogram) noexcept;
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Guesses the field delimiter of a delimited text (e.g. CSV) from a
+///   sample of its first lines - the candidate that appears the same
+///   number of times on most lines. The chars between double quotes
+///   aren't counted and a last line that is cut by the end of the
+///   sample is ignored.
+/// @param candidates
+///   The delimiters that are tried, ties go to the first one
+///   (Default: kDelimiterCandidates).
+/// @returns
+///   The delimiter, or '\0' if no candidate is on the sample.
+/// @example
+///   auto fields = Split(line, DetectDelimiter(sample));
+char DetectDelimiter(
+    std::string_view sample,
+    std::string_view candidates = kDelimiterCandidates);
+
+NS_CORESTRING_END
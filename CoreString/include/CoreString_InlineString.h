@@ -0,0 +1,409 @@
+#pragma once
+
+// std
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+// CoreString
+#include "CoreString_Utils.h"
+#include "CoreString.h"
+
+NS_CORESTRING_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   String with inline storage for up to N chars.
+///   While the contents fit in N chars no memory is allocated at all,
+///   after that the string moves to the heap and behaves like a std::string.
+/// @note
+///   The interface follows the std::string one (lowercase names) so it can
+///   be used as a drop in replacement on generic code.
+template <size_t N>
+class InlineString
+{
+    static_assert(N > 0, "InlineString capacity must be greater than zero");
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    InlineString() noexcept
+    {
+        m_buffer[0] = '\0';
+    }
+
+    InlineString(std::string_view str) :
+        InlineString()
+    {
+        append(str);
+    }
+
+    InlineString(const char *str) :
+        InlineString(std::string_view(str))
+    {
+        // Empty...
+    }
+
+    InlineString(const InlineString &other) :
+        InlineString(std::string_view(other))
+    {
+        // Empty...
+    }
+
+    InlineString(InlineString &&other) noexcept :
+        InlineString()
+    {
+        Steal(other);
+    }
+
+    ~InlineString()
+    {
+        if(!is_inline())
+            delete[] m_pData;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Operators                                                              //
+    //------------------------------------------------------------------------//
+public:
+    InlineString& operator =(const InlineString &other)
+    {
+        if(this != &other)
+        {
+            clear();
+            append(std::string_view(other));
+        }
+        return *this;
+    }
+
+    InlineString& operator =(InlineString &&other) noexcept
+    {
+        if(this != &other)
+        {
+            if(!is_inline())
+                delete[] m_pData;
+
+            m_pData     = m_buffer;
+            m_size      = 0;
+            m_capacity  = N;
+            m_buffer[0] = '\0';
+
+            Steal(other);
+        }
+        return *this;
+    }
+
+    InlineString& operator =(std::string_view str)
+    {
+        clear();
+        return append(str);
+    }
+
+    InlineString& operator +=(std::string_view str) { return append(str); }
+    InlineString& operator +=(char c)               { push_back(c); return *this; }
+
+    char& operator [](size_t index)       noexcept { return m_pData[index]; }
+    char  operator [](size_t index) const noexcept { return m_pData[index]; }
+
+    operator std::string_view() const noexcept
+    {
+        return std::string_view(m_pData, m_size);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    const char* data () const noexcept { return m_pData; }
+    char*       data ()       noexcept { return m_pData; }
+    const char* c_str() const noexcept { return m_pData; }
+
+    size_t size    () const noexcept { return m_size;     }
+    size_t length  () const noexcept { return m_size;     }
+    size_t capacity() const noexcept { return m_capacity; }
+    bool   empty   () const noexcept { return m_size == 0; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   True while the contents still fit in the inline storage.
+    bool is_inline() const noexcept { return m_pData == m_buffer; }
+
+    const char* begin() const noexcept { return m_pData;          }
+    const char* end  () const noexcept { return m_pData + m_size; }
+    char*       begin()       noexcept { return m_pData;          }
+    char*       end  ()       noexcept { return m_pData + m_size; }
+
+    std::string str() const { return std::string(m_pData, m_size); }
+
+    void clear() noexcept
+    {
+        m_size     = 0;
+        m_pData[0] = '\0';
+    }
+
+    void reserve(size_t capacity)
+    {
+        if(capacity <= m_capacity)
+            return;
+
+        // Grow geometrically so repeated appends stay amortized O(1).
+        auto new_capacity = std::max(capacity, m_capacity * 2);
+        auto new_data     = new char[new_capacity + 1];
+        std::memcpy(new_data, m_pData, m_size + 1);
+
+        if(!is_inline())
+            delete[] m_pData;
+
+        m_pData    = new_data;
+        m_capacity = new_capacity;
+    }
+
+    InlineString& append(std::string_view str)
+    {
+        reserve(m_size + str.size());
+        std::memcpy(m_pData + m_size, str.data(), str.size());
+
+        m_size += str.size();
+        m_pData[m_size] = '\0';
+
+        return *this;
+    }
+
+    InlineString& append(size_t count, char c)
+    {
+        reserve(m_size + count);
+        std::memset(m_pData + m_size, c, count);
+
+        m_size += count;
+        m_pData[m_size] = '\0';
+
+        return *this;
+    }
+
+    void push_back(char c)
+    {
+        reserve(m_size + 1);
+        m_pData[m_size++] = c;
+        m_pData[m_size]   = '\0';
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Same as C++23 std::string::resize_and_overwrite. Makes room for
+    ///   count chars and calls op(data, count) that must write the contents
+    ///   and return the size actually used (not greater than count).
+    template <typename Operation>
+    void resize_and_overwrite(size_t count, Operation op)
+    {
+        reserve(count);
+
+        m_size = op(m_pData, count);
+        m_pData[m_size] = '\0';
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    // Expects this to be empty and inline.
+    void Steal(InlineString &other) noexcept
+    {
+        if(other.is_inline())
+        {
+            std::memcpy(m_buffer, other.m_buffer, other.m_size + 1);
+            m_size = other.m_size;
+        }
+        else
+        {
+            m_pData    = other.m_pData;
+            m_size     = other.m_size;
+            m_capacity = other.m_capacity;
+
+            other.m_pData    = other.m_buffer;
+            other.m_capacity = N;
+        }
+
+        other.clear();
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    char   m_buffer[N + 1];
+    char  *m_pData    = m_buffer;
+    size_t m_size     = 0;
+    size_t m_capacity = N;
+};
+
+
+//----------------------------------------------------------------------------//
+// Operators                                                                  //
+//----------------------------------------------------------------------------//
+template <size_t N>
+bool operator ==(const InlineString<N> &lhs, std::string_view rhs) noexcept
+{
+    return std::string_view(lhs) == rhs;
+}
+
+template <size_t N>
+bool operator !=(const InlineString<N> &lhs, std::string_view rhs) noexcept
+{
+    return std::string_view(lhs) != rhs;
+}
+
+template <size_t N>
+std::ostream& operator <<(std::ostream &os, const InlineString<N> &str)
+{
+    return os << std::string_view(str);
+}
+
+
+namespace Private_InlineString
+{
+    template <size_t N>
+    void Append(InlineString<N> &out, std::string_view value) { out.append(value); }
+
+    template <size_t N>
+    void Append(InlineString<N> &out, const char *value) { out.append(value); }
+
+    template <size_t N>
+    void Append(InlineString<N> &out, const std::string &value) { out.append(value); }
+
+    template <size_t N>
+    void Append(InlineString<N> &out, char value) { out.push_back(value); }
+
+    template <size_t N, typename T>
+    void Append(InlineString<N> &out, const T &value)
+    {
+        if constexpr(Private_Number::IsNumber<T>)
+        {
+            char buffer[Private_Number::kMaxChars];
+            auto end = Private_Number::ToChars(buffer, value);
+            out.append(std::string_view(buffer, end - buffer));
+        }
+        else
+        {
+            out.append(Private_Concat::Concat(value));
+        }
+    }
+}
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as PadLeft but the result is built on a InlineString<N>, so it
+///   doesn't allocate if the padded string has up to N chars.
+/// @note
+///   Call it with the capacity explicitly - e.g. PadLeft<64>(str, 10).
+template <size_t N>
+InlineString<N> PadLeft(std::string_view str, size_t length, char c = ' ')
+{
+    InlineString<N> ret;
+    if(str.size() < length)
+        ret.append(length - str.size(), c);
+
+    ret.append(str);
+    return ret;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as PadRight but the result is built on a InlineString<N>.
+/// @see PadLeft<N>.
+template <size_t N>
+InlineString<N> PadRight(std::string_view str, size_t length, char c = ' ')
+{
+    InlineString<N> ret(str);
+    if(str.size() < length)
+        ret.append(length - str.size(), c);
+
+    return ret;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as Center but the result is built on a InlineString<N>.
+/// @see PadLeft<N>.
+template <size_t N>
+InlineString<N> Center(std::string_view str, size_t length, char c = ' ')
+{
+    if(str.size() >= length)
+        return InlineString<N>(str);
+
+    auto left  = (length - str.size()) / 2;
+    auto right = (length - str.size()) - left;
+
+    InlineString<N> ret;
+    ret.reserve(length);
+    ret.append(left, c).append(str).append(right, c);
+
+    return ret;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as Concat but the result is built on a InlineString<N>.
+/// @see PadLeft<N>.
+template <size_t N, typename... Args>
+InlineString<N> Concat(const Args& ...args)
+{
+    using namespace Private_InlineString;
+
+    InlineString<N> ret;
+    (Append(ret, args), ...);
+
+    return ret;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as Format but the result is built on a InlineString<N>.
+///   The format is done directly on the InlineString's buffer, only
+///   needing to allocate when the result doesn't fit N chars.
+/// @see PadLeft<N>.
+template <size_t N, typename... Args>
+InlineString<N> Format(const std::string &str, Args ...args)
+{
+    using namespace Private_Format;
+
+    InlineString<N> ret;
+    if constexpr(sizeof...(args) == 0)
+    {
+        ret.append(str);
+    }
+    else
+    {
+        auto size = std::snprintf(
+            ret.data(),
+            ret.capacity() + 1,
+            str.c_str(),
+            Argument(args)...
+        );
+
+        // Format error, nothing we can do.
+        if(size < 0)
+            return ret;
+
+        // If it didn't fit grow and try again - snprintf already
+        // told us exactly how many chars it needs.
+        ret.resize_and_overwrite(size, [&](char *buf, size_t count) {
+            if(count > N)
+                std::snprintf(buf, count + 1, str.c_str(), Argument(args)...);
+            return count;
+        });
+    }
+
+    return ret;
+}
+
+NS_CORESTRING_END
@@ -0,0 +1,155 @@
+#pragma once
+
+// std
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+// CoreString
+#include "CoreString_Utils.h"
+
+NS_CORESTRING_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Thread safe pool of unique strings.
+///   Every distinct string is stored only once in arena blocks owned by the
+///   pool, so the memory used is proportional to the vocabulary and not to
+///   how many times each string is seen. Interned strings are stable for the
+///   pool's lifetime, so two interned views are equal if (and only if) their
+///   data pointers are equal - same goes for the ids.
+/// @note
+///   The pool is split in shards, each with its own lock, to keep the
+///   contention low when several threads are interning at the same time.
+class InternPool
+{
+    //------------------------------------------------------------------------//
+    // Types                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    typedef uint32_t Id;
+    static constexpr Id kInvalidId = 0xFFFFFFFF;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    InternPool() = default;
+
+    InternPool(const InternPool &) = delete;
+    InternPool& operator =(const InternPool &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the pool's copy of str, adding it if it isn't there yet.
+    /// @returns
+    ///   A view that is valid while the pool lives.
+    std::string_view Intern(std::string_view str);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Same as Intern but returns the handle of the string instead.
+    ///   Use Lookup to get the string back.
+    Id InternId(std::string_view str);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the id of str if it is already interned,
+    ///   kInvalidId otherwise. Never adds anything to the pool.
+    Id Find(std::string_view str) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the string of a id previously returned by InternId.
+    std::string_view Lookup(Id id) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   How many distinct strings are in the pool.
+    size_t Size() const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   How many bytes were allocated for the strings' storage.
+    size_t ArenaBytes() const;
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    struct Shard;
+
+    Id    InternLocked(Shard &shard, size_t shardIndex, std::string_view str);
+    char* Allocate    (Shard &shard, size_t size);
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    // The shard index goes in the lowest bits of the Id.
+    static constexpr size_t kShardBits   = 4;
+    static constexpr size_t kShardsCount = (1 << kShardBits);
+    static constexpr size_t kBlockSize   = 64 * 1024;
+
+    struct Shard
+    {
+        mutable std::mutex                         mutex;
+        std::unordered_map<std::string_view, Id>   ids;
+        std::vector<std::string_view>              strings;
+        std::vector<std::unique_ptr<char[]>>       blocks;
+        char                                      *currentBlock  = nullptr;
+        size_t                                     blockUsed     = kBlockSize;
+        size_t                                     allocatedSize = 0;
+    };
+
+    std::array<Shard, kShardsCount> m_shards;
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Splits a string into substrings that are based on the characters
+///   in an array, interning every substring in the pool.
+/// @param str
+///   The string that will be split.
+/// @param chars
+///   The char array (as a string) of separators.
+/// @param pool
+///   The pool that will hold the substrings.
+/// @returns
+///   A vector of views to the pool's copies of the components, so equal
+///   components have equal data pointers.
+std::vector<std::string_view> Split(
+    const std::string &str,
+    const std::string &chars,
+    InternPool        &pool);
+
+///-----------------------------------------------------------------------------
+/// @brief Same as Split with a pool but only with one char.
+std::vector<std::string_view> Split(
+    const std::string &str,
+    char               c,
+    InternPool        &pool);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as Split with a pool, but returns the ids of the components
+///   so they can be compared and hashed as integers.
+std::vector<InternPool::Id> SplitIds(
+    const std::string &str,
+    const std::string &chars,
+    InternPool        &pool);
+
+NS_CORESTRING_END
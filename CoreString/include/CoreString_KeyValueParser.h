@@ -0,0 +1,122 @@
+#pragma once
+
+// std
+#include <string>
+#include <string_view>
+// CoreString
+#include "CoreString_Utils.h"
+
+NS_CORESTRING_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   How ParseKeyValues splits and cleans the pairs.
+///   The defaults are for query strings (k1=v1&k2=v2), see Headers()
+///   for "Name: value" lines.
+struct KeyValueOptions
+{
+    char pairSeparator   = '&';
+    char assignSeparator = '='; // Only the first one splits the pair.
+
+    // Removes the ASCII white-spaces around the keys and the values.
+    bool trim = false;
+
+    // Decodes the %XX escapes and, if plusAsSpace, the '+' as spaces.
+    bool percentDecode = true;
+    bool plusAsSpace   = true;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   "Name: value" lines - trimmed (so "\r\n" works too) and not decoded.
+    static KeyValueOptions Headers() noexcept
+    {
+        auto options = KeyValueOptions();
+        options.pairSeparator   = '\n';
+        options.assignSeparator = ':';
+        options.trim            = true;
+        options.percentDecode   = false;
+        options.plusAsSpace     = false;
+
+        return options;
+    }
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Reads the (key, value) pairs of a string one at time, in a single
+///   walk of it, without copying it.
+///   The empty pairs are skipped and a pair without the assign separator
+///   is a key with an empty value.
+/// @note
+///   The keys and the values are views to the input, only the ones that
+///   have escapes are decoded to internal buffers - so they're valid
+///   until the next call of Next.
+/// @example
+///   auto parser = ParseKeyValues("q=a%20b&page=2");
+///   std::string_view key, value;
+///   while(parser.Next(key, value))
+///       ...
+class KeyValueParser
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @param input
+    ///   The text that will be parsed. It must outlive the parser.
+    explicit KeyValueParser(
+        std::string_view       input,
+        const KeyValueOptions &options = KeyValueOptions());
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Reads the next pair.
+    /// @returns
+    ///   False if there's no more pairs, true otherwise.
+    bool Next(std::string_view &key, std::string_view &value);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Offset of the input where the next pair starts.
+    size_t Position() const noexcept { return m_position; }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    std::string_view Clean(std::string_view str, std::string &buffer) const;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::string_view m_input;
+    KeyValueOptions  m_options;
+    size_t           m_position;
+
+    std::string m_keyBuffer;
+    std::string m_valueBuffer;
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns a parser of the pairs of input.
+/// @see KeyValueParser.
+inline KeyValueParser ParseKeyValues(
+    std::string_view       input,
+    const KeyValueOptions &options = KeyValueOptions())
+{
+    return KeyValueParser(input, options);
+}
+
+NS_CORESTRING_END
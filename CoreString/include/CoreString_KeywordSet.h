@@ -0,0 +1,318 @@
+#pragma once
+
+// std
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+// CoreString
+#include "CoreString_Utils.h"
+#include "CoreString_Hash.h"
+
+NS_CORESTRING_BEGIN
+
+namespace Private_KeywordSet
+{
+    constexpr uint32_t kEmpty      = 0xFFFFFFFF;
+    constexpr uint64_t kSeedsCount = 8; // Before giving up.
+
+    //--------------------------------------------------------------------------
+    // Hash and displace (CHD): the keys are grouped in buckets by their hash
+    // and each bucket gets the displacement that puts all its keys in free
+    // slots - so the slot of a key is a function of its hash and of the
+    // displacement of its bucket, with no probing.
+    constexpr size_t BucketsCount(size_t keysCount) noexcept
+    {
+        return keysCount / 2 + 1;
+    }
+
+    constexpr size_t Bucket(uint64_t hash, size_t bucketsCount) noexcept
+    {
+        return size_t((hash >> 32) % bucketsCount);
+    }
+
+    constexpr size_t Slot(uint64_t hash, uint32_t displacement, size_t keysCount) noexcept
+    {
+        using namespace Private_Hash;
+        return size_t(Mum(hash ^ kSecret2, kSecret0 ^ (displacement * kSecret1)) % keysCount);
+    }
+
+    //--------------------------------------------------------------------------
+    // Where Build reads and writes, all with keysCount or
+    // bucketsCount (+1 for the bucketStarts) elements.
+    struct Buffers
+    {
+        const std::string_view *keys;
+        uint32_t               *slots;         // Key of each slot.
+        uint32_t               *displacements; // Of each bucket.
+
+        // Scratch.
+        uint64_t *hashes;
+        uint32_t *bucketStarts;
+        uint32_t *bucketKeys;
+        uint32_t *bucketsOrder;
+    };
+
+    //--------------------------------------------------------------------------
+    // Builds the table with the seed. Repeated keys take no slot, so
+    // the lookups find the first one.
+    // Returns false if some bucket had no displacement that fits it.
+    constexpr bool Build(const Buffers &b, size_t keysCount, uint64_t seed)
+    {
+        auto buckets_count = BucketsCount(keysCount);
+
+        // The last keys have few free slots left - a single key
+        // takes keysCount tries in average when only one is free.
+        auto max_tries = 32 * uint64_t(keysCount) + 1024;
+
+        //----------------------------------------------------------------------
+        // Keys grouped by bucket.
+        for(auto i = size_t(0); i <= buckets_count; ++i)
+            b.bucketStarts[i] = 0;
+
+        for(auto i = size_t(0); i < keysCount; ++i)
+        {
+            b.hashes[i] = Hash64(b.keys[i], seed);
+            ++b.bucketStarts[Bucket(b.hashes[i], buckets_count) + 1];
+        }
+
+        auto max_size = uint32_t(0);
+        for(auto i = size_t(0); i < buckets_count; ++i)
+        {
+            max_size = (b.bucketStarts[i + 1] > max_size) ? b.bucketStarts[i + 1] : max_size;
+            b.bucketStarts[i + 1] += b.bucketStarts[i];
+            b.bucketsOrder[i] = b.bucketStarts[i]; // Fill cursors for now.
+        }
+
+        for(auto i = size_t(0); i < keysCount; ++i)
+        {
+            auto bucket = Bucket(b.hashes[i], buckets_count);
+            b.bucketKeys[b.bucketsOrder[bucket]++] = uint32_t(i);
+        }
+
+        //----------------------------------------------------------------------
+        // The biggest buckets first, while there's plenty of free slots.
+        auto count = size_t(0);
+        for(auto size = max_size; size > 0; --size)
+        {
+            for(auto i = size_t(0); i < buckets_count; ++i)
+            {
+                if(b.bucketStarts[i + 1] - b.bucketStarts[i] == size)
+                    b.bucketsOrder[count++] = uint32_t(i);
+            }
+        }
+
+        for(auto i = size_t(0); i < keysCount; ++i)
+            b.slots[i] = kEmpty;
+
+        for(auto i = size_t(0); i < count; ++i)
+        {
+            auto bucket = b.bucketsOrder[i];
+            auto begin  = b.bucketStarts[bucket];
+            auto end    = b.bucketStarts[bucket + 1];
+
+            auto placed = false;
+            for(auto displacement = uint32_t(0); !placed && displacement < max_tries; ++displacement)
+            {
+                placed = true;
+                for(auto j = begin; j < end; ++j)
+                {
+                    auto key = b.bucketKeys[j];
+
+                    // Repeated keys are on the same bucket.
+                    auto repeated = false;
+                    for(auto k = begin; k < j && !repeated; ++k)
+                        repeated = (b.keys[b.bucketKeys[k]] == b.keys[key]);
+                    if(repeated)
+                        continue;
+
+                    auto slot = Slot(b.hashes[key], displacement, keysCount);
+                    if(b.slots[slot] == kEmpty)
+                    {
+                        b.slots[slot] = key;
+                        continue;
+                    }
+
+                    // Takes back what this displacement placed.
+                    for(auto k = begin; k < j; ++k)
+                    {
+                        auto other = Slot(b.hashes[b.bucketKeys[k]], displacement, keysCount);
+                        if(b.slots[other] == b.bucketKeys[k])
+                            b.slots[other] = kEmpty;
+                    }
+
+                    placed = false;
+                    break;
+                }
+
+                if(placed)
+                    b.displacements[bucket] = displacement;
+            }
+
+            if(!placed)
+                return false;
+        }
+
+        return true;
+    }
+}
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Set of keywords with a minimal perfect hash built at construction:
+///   each keyword has its own slot, so Contains is one Hash64, one
+///   lookup of the bucket's displacement and one compare - no probing
+///   and no allocation.
+/// @note
+///   For keywords known at compile time see MakeKeywordSet.
+class KeywordSet
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @param keywords
+    ///   The keywords, they're copied. Repeated keywords are ignored.
+    explicit KeywordSet(const std::vector<std::string> &keywords);
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    bool Contains(std::string_view str) const noexcept
+    {
+        return Find(str) != std::string::npos;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the index (in the constructor's vector) of the keyword
+    ///   equal to str, or std::string::npos if str isn't a keyword.
+    size_t Find(std::string_view str) const noexcept;
+
+    size_t Size() const noexcept { return m_offsets.size() - 1; }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::string           m_data;    // The keywords.
+    std::vector<uint32_t> m_offsets; // On m_data, one extra at the end.
+
+    std::vector<uint32_t> m_slots;
+    std::vector<uint32_t> m_displacements;
+    uint64_t              m_seed;
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as KeywordSet but with the keywords known at compile time,
+///   so the whole table can be built by the compiler. The keywords are
+///   views, they must outlive the set (string literals do).
+/// @see MakeKeywordSet.
+template <size_t N>
+class StaticKeywordSet
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    constexpr explicit StaticKeywordSet(const std::array<std::string_view, N> &keywords) :
+        m_keywords     (keywords),
+        m_slots        {},
+        m_displacements{},
+        m_seed         (0)
+    {
+        using namespace Private_KeywordSet;
+
+        std::array<uint64_t, N>                 hashes        {};
+        std::array<uint32_t, kBucketsCount + 1> bucket_starts {};
+        std::array<uint32_t, N>                 bucket_keys   {};
+        std::array<uint32_t, kBucketsCount>     buckets_order {};
+
+        auto buffers = Buffers{
+            m_keywords     .data(),
+            m_slots        .data(),
+            m_displacements.data(),
+            hashes         .data(),
+            bucket_starts  .data(),
+            bucket_keys    .data(),
+            buckets_order  .data()
+        };
+
+        while(m_seed < kSeedsCount && !Build(buffers, N, m_seed))
+            ++m_seed;
+
+        // As KeywordSet asserts - on a constant evaluated
+        // MakeKeywordSet this is a compile error.
+        if(m_seed == kSeedsCount)
+            throw std::logic_error("StaticKeywordSet couldn't find a perfect hash");
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    constexpr bool Contains(std::string_view str) const noexcept
+    {
+        return Find(str) != std::string_view::npos;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the index of the keyword equal to str, or
+    ///   std::string::npos if str isn't a keyword.
+    constexpr size_t Find(std::string_view str) const noexcept
+    {
+        using namespace Private_KeywordSet;
+        if(N == 0)
+            return std::string_view::npos;
+
+        auto hash   = Hash64(str, m_seed);
+        auto bucket = Bucket(hash, kBucketsCount);
+        auto key    = m_slots[Slot(hash, m_displacements[bucket], N)];
+
+        if(key == kEmpty || m_keywords[key] != str)
+            return std::string_view::npos;
+
+        return key;
+    }
+
+    constexpr size_t Size() const noexcept { return N; }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    static constexpr size_t kBucketsCount = Private_KeywordSet::BucketsCount(N);
+
+    std::array<std::string_view, N>     m_keywords;
+    std::array<uint32_t, N>             m_slots;
+    std::array<uint32_t, kBucketsCount> m_displacements;
+    uint64_t                            m_seed;
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Makes a StaticKeywordSet of the keywords, e.g:
+///     constexpr auto kKeywords = CoreString::MakeKeywordSet("if", "for");
+///     static_assert(kKeywords.Contains("for"));
+template <typename ...Args>
+constexpr StaticKeywordSet<sizeof...(Args)> MakeKeywordSet(const Args &...keywords)
+{
+    return StaticKeywordSet<sizeof...(Args)>(
+        std::array<std::string_view, sizeof...(Args)>{ std::string_view(keywords)... }
+    );
+}
+
+NS_CORESTRING_END
@@ -0,0 +1,131 @@
+#pragma once
+
+// std
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+// CoreString
+#include "CoreString_Utils.h"
+
+NS_CORESTRING_BEGIN
+
+namespace Private_Number
+{
+    //--------------------------------------------------------------------------
+    // The types that are formatted as numbers.
+    //   bool and the char types are left out, since the streams
+    //   (and so the users) treat them as text.
+    template <typename T>
+    constexpr bool IsNumber =
+        std::is_floating_point_v<T> ||
+        (std::is_integral_v<T>                &&
+         !std::is_same_v<T, bool>             &&
+         !std::is_same_v<T, char>             &&
+         !std::is_same_v<T, signed char>      &&
+         !std::is_same_v<T, unsigned char>    &&
+         !std::is_same_v<T, wchar_t>          &&
+         !std::is_same_v<T, char16_t>         &&
+         !std::is_same_v<T, char32_t>);
+
+    // Room for the longest shortest round trip representation
+    // of any of the types above (long double included).
+    constexpr size_t kMaxChars = 64;
+
+    //--------------------------------------------------------------------------
+    // Writes value to buffer returning the end of the written chars.
+    template <typename T>
+    char* ToChars(char *buffer, T value) noexcept
+    {
+        return std::to_chars(buffer, buffer + kMaxChars, value).ptr;
+    }
+}
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns the string representation of the number.
+///   The integers are written in base 10 and the floating points use
+///   the shortest representation that reads back to the same value.
+/// @note
+///   No locale, stream or heap allocation is involved - the result
+///   always fits the std::string small buffer for the integers.
+template <
+    typename T,
+    typename = std::enable_if_t<Private_Number::IsNumber<T>>
+>
+std::string ToString(T value)
+{
+    char buffer[Private_Number::kMaxChars];
+    return std::string(buffer, Private_Number::ToChars(buffer, value));
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as ToString but appends the result to out.
+template <
+    typename T,
+    typename = std::enable_if_t<Private_Number::IsNumber<T>>
+>
+void ToStringTo(std::string &out, T value)
+{
+    char buffer[Private_Number::kMaxChars];
+    out.append(buffer, Private_Number::ToChars(buffer, value));
+}
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Tries to parse the whole string as a number.
+///   Accepts an optional sign ('+' or '-' for the signed types) and the
+///   integers must be in base 10. The floating points accept the fixed and
+///   scientific notations as well as "inf" and "nan".
+/// @param str
+///   The string that will be parsed - no whitespace is allowed.
+/// @param value
+///   Where the parsed number is stored. It's left untouched on failure.
+/// @returns
+///   True if the string was a valid number in the range of T,
+///   false otherwise.
+template <
+    typename T,
+    typename = std::enable_if_t<Private_Number::IsNumber<T>>
+>
+bool TryParse(std::string_view str, T &value) noexcept
+{
+    auto first = str.data();
+    auto last  = str.data() + str.size();
+
+    // from_chars doesn't accept the plus sign.
+    if(first != last && *first == '+' && (last - first) > 1 && first[1] != '-')
+        ++first;
+
+    T parsed;
+    auto result = std::from_chars(first, last, parsed);
+    if(result.ec != std::errc() || result.ptr != last)
+        return false;
+
+    value = parsed;
+    return true;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Parses the whole string as a number.
+/// @param str
+///   The string that will be parsed.
+/// @param defaultValue
+///   What is returned if the string isn't a valid number.
+/// @see TryParse.
+template <
+    typename T,
+    typename = std::enable_if_t<Private_Number::IsNumber<T>>
+>
+T Parse(std::string_view str, T defaultValue = T()) noexcept
+{
+    TryParse(str, defaultValue);
+    return defaultValue;
+}
+
+NS_CORESTRING_END
@@ -0,0 +1,145 @@
+#pragma once
+
+// std
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+// CoreString
+#include "CoreString_Utils.h"
+#include "CoreString_WhiteSpace.h"
+
+NS_CORESTRING_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   A step of a Pipe - they're made by the functions of CoreString::Stages.
+struct PipeStage
+{
+    enum class Kind
+    {
+        Map,       // Byte to byte, with pTable or pFunc.
+        Trim,      // Both ends, of the chars in what.
+        TrimStart,
+        TrimEnd,
+        Replace    // The occurrences of what by to.
+    };
+
+    Kind             kind;
+    const uint8_t   *pTable;
+    char           (*pFunc)(char);
+    std::string_view what;
+    std::string_view to;
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   The stages that can be chained on a Pipe.
+/// @note
+///   They're on their own namespace since some have the names (but not
+///   the parameters) of the CoreString functions that do the same.
+namespace Stages
+{
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Removes the chars at both ends / the start / the end of the string
+    ///   (Default: kWhiteSpaceChars).
+    PipeStage Trim     (std::string_view chars = kWhiteSpaceChars) noexcept;
+    PipeStage TrimStart(std::string_view chars = kWhiteSpaceChars) noexcept;
+    PipeStage TrimEnd  (std::string_view chars = kWhiteSpaceChars) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Replaces all the occurrences of what by to.
+    /// @note
+    ///   Replacing a single char by a single char is byte-local, any other
+    ///   replace changes the length so it ends the current pass.
+    PipeStage Replace(std::string_view what, std::string_view to) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   The case conversions of ToLower, ToUpper and SwapCase.
+    PipeStage ToLower () noexcept;
+    PipeStage ToUpper () noexcept;
+    PipeStage SwapCase() noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Passes each byte through func - it must give the same output
+    ///   for the same input.
+    PipeStage Map(char (*func)(char)) noexcept;
+}
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Chains transformations of a string and runs them only when the result
+///   is asked for, instead of making a new string for each one of them.
+///
+///   The byte-local stages (case conversions, single char replaces, Map)
+///   are composed into a single 256 bytes table and the trims only narrow
+///   the view of the string, so they're all done in one pass that writes
+///   straight into the result, sized up front. Only the replaces that
+///   change the length make an intermediate string.
+/// @note
+///   The source string and the strings given to the stages must outlive
+///   the pipe.
+/// @example
+///   using namespace CoreString::Stages;
+///   auto str = (Pipe(input) | Trim() | Replace("\t", " ") | ToLower()).ToString();
+class Pipe
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    explicit Pipe(std::string_view str);
+
+
+    //------------------------------------------------------------------------//
+    // Operators                                                              //
+    //------------------------------------------------------------------------//
+public:
+    operator std::string() const { return ToString(); }
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Adds the stage at the end of the pipe, nothing is done yet.
+    Pipe& Then(const PipeStage &stage);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Runs the stages and returns the result.
+    std::string ToString() const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Same as ToString but appends the result to out instead of returning
+    ///   a new string, so the same buffer can be reused between calls.
+    void To(std::string &out) const;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::string_view       m_source;
+    std::vector<PipeStage> m_stages;
+};
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as pipe.Then(stage).
+inline Pipe operator|(Pipe pipe, const PipeStage &stage)
+{
+    pipe.Then(stage);
+    return pipe;
+}
+
+NS_CORESTRING_END
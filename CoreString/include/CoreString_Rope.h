@@ -0,0 +1,221 @@
+#pragma once
+
+// std
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+// CoreString
+#include "CoreString_Utils.h"
+
+NS_CORESTRING_BEGIN
+
+namespace Private_Rope
+{
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Immutable node of a Rope, shared between the ropes that have it.
+    ///   Leaves are a range of a (shared) buffer, the other nodes have both
+    ///   children - the tree is kept balanced as an AVL, by the heights.
+    struct Node
+    {
+        std::shared_ptr<const Node>        left;
+        std::shared_ptr<const Node>        right;
+        std::shared_ptr<const std::string> buffer; // Leaves only.
+
+        size_t offset; // On the buffer.
+        size_t size;
+        int    height; // 0 for the leaves.
+
+        bool IsLeaf() const noexcept { return !left; }
+        std::string_view Text() const noexcept
+        {
+            return std::string_view(buffer->data() + offset, size);
+        }
+    };
+
+    typedef std::shared_ptr<const Node> NodePtr;
+}
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   String made of a balanced tree of immutable chunks, to edit large
+///   texts without copying them on every operation.
+///   Insert, Erase, Substr and Append are O(log n) and copying a rope is
+///   O(1) - the chunks are shared, never modified.
+///
+///   The text is never made contiguous unless asked (Flatten), the
+///   Rope overloads of Find, Count, Replace and Split walk the chunks
+///   with a RopeChunkIterator.
+/// @note
+///   Small pieces appended next to small chunks are merged into a
+///   single chunk, so building a rope a few chars at time doesn't
+///   make a node for each piece.
+class Rope
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    Rope() = default;
+
+    explicit Rope(std::string_view str);
+    explicit Rope(const char *str) : Rope(std::string_view(str)) {}
+
+    // Takes the string's buffer as the first chunk.
+    explicit Rope(std::string &&str);
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    size_t Size () const noexcept { return (m_root) ? m_root->size : 0; }
+    bool   Empty() const noexcept { return !m_root;                      }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   The char at index - O(log n).
+    char At(size_t index) const noexcept;
+    char operator [](size_t index) const noexcept { return At(index); }
+
+    void Append(std::string_view str);
+    void Append(const Rope &rope);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Inserts str before the char at index (Size() appends).
+    void Insert(size_t index, std::string_view str);
+    void Insert(size_t index, const Rope &rope);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Removes count chars starting at index
+    ///   (Default: std::string::npos - until the end).
+    void Erase(size_t index, size_t count = std::string::npos);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the count chars starting at index
+    ///   (Default: std::string::npos - until the end).
+    ///   The chunks are shared, nothing is copied.
+    Rope Substr(size_t index, size_t count = std::string::npos) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Copies the whole text to a single string.
+    std::string Flatten() const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   The height of the tree - the chunks are at most this deep.
+    int Height() const noexcept { return (m_root) ? m_root->height : 0; }
+
+    const Private_Rope::NodePtr& Root() const noexcept { return m_root; }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    explicit Rope(Private_Rope::NodePtr root) : m_root(std::move(root)) {}
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    // Null for the empty rope.
+    Private_Rope::NodePtr m_root;
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Walks the chunks of a Rope in order.
+/// @note
+///   The rope must outlive the iterator.
+/// @example
+///   RopeChunkIterator it(rope);
+///   std::string_view chunk;
+///   while(it.Next(chunk))
+///       ...
+class RopeChunkIterator
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @param position
+    ///   Where the first chunk will start, it can be in the middle of a
+    ///   chunk (Default: 0 - the start of the rope).
+    explicit RopeChunkIterator(const Rope &rope, size_t position = 0);
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Reads the next chunk.
+    /// @returns
+    ///   False if there's no more chunks, true otherwise.
+    bool Next(std::string_view &chunk);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Offset of the rope where the next chunk starts.
+    size_t Position() const noexcept { return m_position; }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    // The nodes still to be visited, the next one at the back.
+    std::vector<const Private_Rope::Node *> m_stack;
+
+    size_t m_skip;     // Chars to skip of the next leaf.
+    size_t m_position;
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns the index of the first occurrence of needle in rope,
+///   starting at start (Default: 0), or std::string::npos if there's
+///   none. Matches that cross the chunks' boundaries are found as well.
+size_t Find(const Rope &rope, std::string_view needle, size_t start = 0);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns true if needle is in rope.
+/// @see Find.
+bool Contains(const Rope &rope, std::string_view needle);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns the number of non-overlapping occurrences of needle in rope.
+size_t Count(const Rope &rope, std::string_view needle);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns a rope with all the (non-overlapping) occurrences of what
+///   replaced by to. The text between the occurrences is shared with
+///   rope, not copied.
+Rope Replace(const Rope &rope, std::string_view what, std::string_view to);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Splits the rope at any of the chars (as in Split for strings).
+std::vector<std::string> Split(const Rope &rope, std::string_view chars);
+
+///-----------------------------------------------------------------------------
+/// @brief Same as Split with a char array (as a string)
+/// but only with one char.
+std::vector<std::string> Split(const Rope &rope, char c);
+
+NS_CORESTRING_END
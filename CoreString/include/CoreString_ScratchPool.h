@@ -0,0 +1,65 @@
+#pragma once
+
+// std
+#include <cstdint>
+#include <string>
+// CoreString
+#include "CoreString_Utils.h"
+
+NS_CORESTRING_BEGIN
+
+namespace Private_Scratch
+{
+    //--------------------------------------------------------------------------
+    // Takes a buffer from the calling thread's pool (out is left empty if
+    // the pool has none) and gives it back. Only a few buffers, of bounded
+    // capacity, are kept - the others are just freed.
+    void Acquire(std::string &out) noexcept;
+    void Release(std::string &&buffer) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Empty string from the pool while in scope, for the temporaries of
+    // the functions - so the steady state calls don't go to the allocator.
+    class ScratchString
+    {
+    public:
+        ScratchString() noexcept { Acquire(m_buffer);            }
+        ~ScratchString()         { Release(std::move(m_buffer)); }
+
+        ScratchString(const ScratchString &) = delete;
+        ScratchString& operator =(const ScratchString &) = delete;
+
+        std::string& operator *()  noexcept { return m_buffer;  }
+        std::string* operator ->() noexcept { return &m_buffer; }
+
+    private:
+        std::string m_buffer;
+    };
+}
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   How the scratch buffers pool (used internally for the temporaries
+///   of Contains, Format...) is doing, summed for all the threads.
+struct ScratchPoolStats
+{
+    uint64_t hits;    // A pooled buffer was reused.
+    uint64_t misses;  // The pool was empty, a new buffer was made.
+    uint64_t dropped; // Buffers freed since the pool was full or them too big.
+};
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns the counters of the scratch buffers pool.
+/// @note
+///   The counters are updated with relaxed atomics, so they're exact
+///   only when no other thread is using the pool.
+ScratchPoolStats GetScratchPoolStats() noexcept;
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Sets the counters of the scratch buffers pool back to zero.
+void ResetScratchPoolStats() noexcept;
+
+NS_CORESTRING_END
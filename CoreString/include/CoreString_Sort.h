@@ -0,0 +1,98 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+// CoreString
+#include "CoreString_Utils.h"
+
+NS_CORESTRING_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Sorts the strings in [first, last) in the order of std::string's
+///   operator < (bytes compared as unsigned chars).
+///   It's a MSD radix sort that turns into a multikey quicksort for the
+///   smaller buckets, so each char is looked at about once instead of the
+///   common prefixes being compared again on each comparison.
+///   The sort isn't stable.
+/// @param threadsCount
+///   How many threads will sort the buckets of the first char
+///   (Default: 0 - as many as the hardware has). Small inputs always
+///   use only the calling thread.
+void SortStrings(
+    std::string *first,
+    std::string *last,
+    size_t       threadsCount = 0);
+
+void SortStrings(
+    std::string_view *first,
+    std::string_view *last,
+    size_t            threadsCount = 0);
+
+void SortStrings(std::vector<std::string>      &strings, size_t threadsCount = 0);
+void SortStrings(std::vector<std::string_view> &strings, size_t threadsCount = 0);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as SortStrings but ignoring the case of the ASCII letters,
+///   so the order is the one of CompareIgnoreCase (and CaseInsensitiveLess).
+void SortStringsIgnoreCase(
+    std::string *first,
+    std::string *last,
+    size_t       threadsCount = 0);
+
+void SortStringsIgnoreCase(
+    std::string_view *first,
+    std::string_view *last,
+    size_t            threadsCount = 0);
+
+void SortStringsIgnoreCase(std::vector<std::string>      &strings, size_t threadsCount = 0);
+void SortStringsIgnoreCase(std::vector<std::string_view> &strings, size_t threadsCount = 0);
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Compares both strings in natural order, i.e. the runs of digits are
+///   compared by their numeric value, so "file2" comes before "file10".
+///   The numbers can have any length (they're never converted) and the
+///   ones with the same value but more leading zeros come after, so only
+///   equal strings compare as equal. No copy of the strings is made.
+/// @returns
+///   A negative number if lhs comes before rhs, zero if they are
+///   equal and a positive number if lhs comes after rhs.
+int NaturalCompare(std::string_view lhs, std::string_view rhs) noexcept;
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as NaturalCompare but ignoring the case of the ASCII letters,
+///   as the file managers do.
+int NaturalCompareIgnoreCase(std::string_view lhs, std::string_view rhs) noexcept;
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Functors to sort (std::sort) or to key the ordered containers
+///   in natural order. Both are transparent.
+/// @see CaseInsensitiveLess for the case insensitive lexicographic order.
+struct NaturalLess
+{
+    typedef void is_transparent;
+    bool operator()(std::string_view lhs, std::string_view rhs) const noexcept
+    {
+        return NaturalCompare(lhs, rhs) < 0;
+    }
+};
+
+struct NaturalLessIgnoreCase
+{
+    typedef void is_transparent;
+    bool operator()(std::string_view lhs, std::string_view rhs) const noexcept
+    {
+        return NaturalCompareIgnoreCase(lhs, rhs) < 0;
+    }
+};
+
+NS_CORESTRING_END
@@ -0,0 +1,112 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+// CoreString
+#include "CoreString_Utils.h"
+
+NS_CORESTRING_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Finds needles in a stream that is given in chunks (e.g. the reads of
+///   a socket or a file), including the matches that cross the chunks'
+///   boundaries, without ever keeping the whole stream.
+///
+///   With a single needle only its last (needle.size() - 1) bytes are kept
+///   between the chunks and each chunk is searched with std::string_view's
+///   find. With many needles they're compiled to an Aho-Corasick automaton
+///   (a DFA over the bytes that appear on the needles) and only its
+///   current state is kept.
+/// @note
+///   All the occurrences are reported, overlapping ones included.
+/// @example
+///   StreamSearcher searcher("needle");
+///   std::vector<StreamSearcher::Match> matches;
+///   while(ReadChunk(chunk))
+///       searcher.Feed(chunk, matches);
+class StreamSearcher
+{
+    //------------------------------------------------------------------------//
+    // Types                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    struct Match
+    {
+        uint64_t offset; // On the stream, of the first byte.
+        size_t   needle; // Index of the needle (0 with a single one).
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @param needle
+    ///   What will be searched - empty needles never match.
+    explicit StreamSearcher(std::string_view needle);
+
+    ///-------------------------------------------------------------------------
+    /// @param needles
+    ///   What will be searched, the matches have the index of the needle
+    ///   on this vector - empty needles never match.
+    explicit StreamSearcher(const std::vector<std::string> &needles);
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Searches the next chunk of the stream, appending to matches the
+    ///   occurrences that end on it - in the order that they end.
+    void Feed(std::string_view chunk, std::vector<Match> &matches);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Forgets the chunks given so far, to search a new stream.
+    void Reset() noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   How many bytes were given so far, i.e. the offset of the next chunk.
+    uint64_t Position() const noexcept { return m_position; }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void FeedSingle   (std::string_view chunk, std::vector<Match> &matches);
+    void FeedAutomaton(std::string_view chunk, std::vector<Match> &matches);
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    uint64_t m_position;
+
+    // Single needle.
+    std::string m_needle;
+    std::string m_carry;    // The last (needle.size() - 1) bytes of the stream.
+    std::string m_boundary; // The carry plus the start of the chunk.
+
+    // Many needles - m_transitions has m_classesCount entries by state,
+    // the states that end needles have their indexes on m_outputs.
+    std::vector<uint32_t> m_transitions;
+    std::vector<uint32_t> m_outputsOffsets;
+    std::vector<uint32_t> m_outputs;
+    std::vector<size_t>   m_needlesSizes;
+    uint16_t              m_classes[256];
+    size_t                m_classesCount;
+    uint32_t              m_state;
+};
+
+NS_CORESTRING_END
@@ -0,0 +1,210 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+// CoreString
+#include "CoreString_Utils.h"
+
+NS_CORESTRING_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Append only list of strings that keeps all the chars in a single
+///   buffer plus the offset where each string starts - so keeping many
+///   small strings costs two allocations instead of one for each of them,
+///   and walking them reads the memory in order.
+///   The strings are given back as std::string_view, by index or by a
+///   random access range (so it works with the std algorithms).
+/// @note
+///   As with std::vector, appending invalidates the views and iterators.
+class StringTable
+{
+    //------------------------------------------------------------------------//
+    // Types                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    class Iterator
+    {
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef std::string_view                value_type;
+        typedef std::ptrdiff_t                  difference_type;
+        typedef std::string_view                reference;
+        typedef void                            pointer;
+
+    public:
+        Iterator() noexcept = default;
+
+        Iterator(const char *pChars, const size_t *pOffset) noexcept :
+            m_pChars (pChars),
+            m_pOffset(pOffset)
+        {
+            // Empty...
+        }
+
+    public:
+        std::string_view operator *() const noexcept
+        {
+            return std::string_view(m_pChars + m_pOffset[0], m_pOffset[1] - m_pOffset[0]);
+        }
+
+        std::string_view operator [](difference_type n) const noexcept { return *(*this + n); }
+
+        Iterator& operator ++() noexcept { ++m_pOffset; return *this; }
+        Iterator& operator --() noexcept { --m_pOffset; return *this; }
+        Iterator  operator ++(int) noexcept { auto it = *this; ++m_pOffset; return it; }
+        Iterator  operator --(int) noexcept { auto it = *this; --m_pOffset; return it; }
+
+        Iterator& operator +=(difference_type n) noexcept { m_pOffset += n; return *this; }
+        Iterator& operator -=(difference_type n) noexcept { m_pOffset -= n; return *this; }
+
+        Iterator operator +(difference_type n) const noexcept { return Iterator(m_pChars, m_pOffset + n); }
+        Iterator operator -(difference_type n) const noexcept { return Iterator(m_pChars, m_pOffset - n); }
+
+        friend Iterator operator +(difference_type n, const Iterator &it) noexcept { return it + n; }
+
+        difference_type operator -(const Iterator &other) const noexcept
+        {
+            return m_pOffset - other.m_pOffset;
+        }
+
+        bool operator ==(const Iterator &other) const noexcept { return m_pOffset == other.m_pOffset; }
+        bool operator !=(const Iterator &other) const noexcept { return m_pOffset != other.m_pOffset; }
+        bool operator < (const Iterator &other) const noexcept { return m_pOffset <  other.m_pOffset; }
+        bool operator > (const Iterator &other) const noexcept { return m_pOffset >  other.m_pOffset; }
+        bool operator <=(const Iterator &other) const noexcept { return m_pOffset <= other.m_pOffset; }
+        bool operator >=(const Iterator &other) const noexcept { return m_pOffset >= other.m_pOffset; }
+
+    private:
+        const char   *m_pChars  = nullptr;
+        const size_t *m_pOffset = nullptr; // Of the current string.
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    StringTable() :
+        m_offsets(1, 0)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Operators                                                              //
+    //------------------------------------------------------------------------//
+public:
+    std::string_view operator [](size_t index) const noexcept
+    {
+        return std::string_view(
+            m_chars.data() + m_offsets[index],
+            m_offsets[index + 1] - m_offsets[index]
+        );
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Adds a copy of str at the end.
+    void Append(std::string_view str)
+    {
+        m_chars.append(str);
+        m_offsets.push_back(m_chars.size());
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Makes room for more strings and chars (the totals, as in
+    ///   std::vector::reserve), so they can be appended without reallocations.
+    void Reserve(size_t stringsCount, size_t charsCount)
+    {
+        m_offsets.reserve(stringsCount + 1);
+        m_chars  .reserve(charsCount);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Removes all the strings, keeping the memory to be reused.
+    void Clear() noexcept
+    {
+        m_chars.clear();
+        m_offsets.resize(1);
+    }
+
+    size_t Size () const noexcept { return m_offsets.size() - 1; }
+    bool   Empty() const noexcept { return m_offsets.size() == 1; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   All the strings one after the other, without separators.
+    std::string_view Chars() const noexcept { return m_chars; }
+
+    Iterator begin() const noexcept { return Iterator(m_chars.data(), m_offsets.data());          }
+    Iterator end  () const noexcept { return Iterator(m_chars.data(), m_offsets.data() + Size()); }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::string         m_chars;
+    std::vector<size_t> m_offsets; // Where each string starts, plus the end.
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Splits a string into substrings that are based on the characters
+///   in an array (as Split does), appending them to a StringTable instead
+///   of making a std::string of each.
+/// @param str
+///   The string that will be split.
+/// @param chars
+///   The char array (as a string) of separators.
+/// @param table
+///   The table where the components are appended - it isn't cleared, so
+///   the results of many calls can be kept together.
+void Split(std::string_view str, std::string_view chars, StringTable &table);
+
+///-----------------------------------------------------------------------------
+/// @brief Same as Split with a StringTable but only with one char.
+void Split(std::string_view str, char c, StringTable &table);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as Split with a StringTable but returns a new table.
+/// @note
+///   They're templates only so the std::string overloads of CoreString.h
+///   keep being picked for string literals and std::string - these ones
+///   are picked for std::string_view.
+/// @example
+///   auto table = Split(std::string_view(line), ',');
+template <typename Table = StringTable>
+StringTable Split(std::string_view str, std::string_view chars)
+{
+    auto table = StringTable();
+    Split(str, chars, table);
+
+    return table;
+}
+
+template <typename Table = StringTable>
+StringTable Split(std::string_view str, char c)
+{
+    auto table = StringTable();
+    Split(str, c, table);
+
+    return table;
+}
+
+NS_CORESTRING_END
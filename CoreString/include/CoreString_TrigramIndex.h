@@ -0,0 +1,104 @@
+#pragma once
+
+// std
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+// CoreString
+#include "CoreString_Utils.h"
+
+NS_CORESTRING_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Inverted index of the trigrams (3 chars substrings) of a set of
+///   strings, to find the strings that are close to a query without
+///   comparing it against all of them.
+///
+///   If a string is k edits away from the query, at most 3k of the query's
+///   distinct trigrams can be missing from it - so only the strings that
+///   share enough trigrams (and have a close enough length) are verified
+///   with EditDistance.
+/// @note
+///   The strings are padded (two chars at the start, one at the end) so
+///   short strings have trigrams as well. The posting lists are stored
+///   delta encoded as varints, and the strings themselves are copied to
+///   a single buffer.
+class TrigramIndex
+{
+    //------------------------------------------------------------------------//
+    // Types                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    struct Match
+    {
+        size_t index;    // In the constructor's vector.
+        size_t distance; // Levenshtein distance to the query.
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @param strings
+    ///   The strings that will be indexed.
+    /// @param threadsCount
+    ///   How many threads will build the index
+    ///   (Default: 0 - as many as the hardware has).
+    explicit TrigramIndex(
+        const std::vector<std::string> &strings,
+        size_t                          threadsCount = 0);
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Finds the strings that are at most maxDistance edits away
+    ///   from the query.
+    /// @returns
+    ///   The matches sorted by distance (and then by index).
+    std::vector<Match> Find(std::string_view query, size_t maxDistance) const;
+
+    size_t Size() const noexcept { return m_offsets.size() - 1; }
+
+    std::string_view operator [](size_t index) const noexcept
+    {
+        return std::string_view(
+            m_data.data() + m_offsets[index],
+            m_offsets[index + 1] - m_offsets[index]
+        );
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   How many distinct trigrams were indexed.
+    size_t TrigramsCount() const noexcept { return m_keys.size(); }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Bytes used by the encoded posting lists.
+    size_t PostingsBytes() const noexcept { return m_postings.size(); }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    // The strings.
+    std::string         m_data;
+    std::vector<size_t> m_offsets;
+
+    // Sorted trigrams, and where the posting list of each one
+    // starts on m_postings (one extra at the end).
+    std::vector<uint32_t> m_keys;
+    std::vector<size_t>   m_postingsOffsets;
+    std::vector<uint8_t>  m_postings;
+};
+
+NS_CORESTRING_END
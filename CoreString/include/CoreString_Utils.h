@@ -4,3 +4,13 @@
 #define NS_CORESTRING_BEGIN namespace CoreString {
 #define NS_CORESTRING_END   }
 #define USING_NS_CORESTRING using namespace CoreString
+
+//------------------------------------------------------------------------------
+// Defining CORESTRING_HEADER_ONLY (the CoreString_HeaderOnly target does)
+// makes include/CoreString.h include its implementation with all the
+// functions inline, so the compiler can inline them on the callers.
+#if defined(CORESTRING_HEADER_ONLY)
+    #define CORESTRING_INLINE inline
+#else
+    #define CORESTRING_INLINE
+#endif
@@ -0,0 +1,120 @@
+#pragma once
+
+// std
+#include <cstddef>
+#include <string>
+#include <string_view>
+// CoreString
+#include "CoreString_Utils.h"
+
+NS_CORESTRING_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   The ASCII white-space chars: space, tab, line feed, vertical tab,
+///   form feed and carriage return.
+///   It's the default set of the Trim functions, that scan it 16 bytes
+///   at time (the other sets go through find_first_not_of).
+inline constexpr char kWhiteSpaceChars[] = " \t\n\v\f\r";
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Which chars the white-space functions consider.
+enum class WhiteSpaceClass
+{
+    ///-------------------------------------------------------------------------
+    /// The kWhiteSpaceChars.
+    Ascii,
+
+    ///-------------------------------------------------------------------------
+    /// The ASCII ones plus the UTF-8 encoded chars with the Unicode
+    /// White_Space property (U+0085, U+00A0, U+1680, U+2000...U+200A,
+    /// U+2028, U+2029, U+202F, U+205F and U+3000).
+    Unicode
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns true if c is one of the kWhiteSpaceChars.
+constexpr bool IsWhiteSpace(char c) noexcept
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns the index of the first char of str that isn't a white-space,
+///   or std::string_view::npos if there's none.
+size_t FindFirstNotWhiteSpace(
+    std::string_view str,
+    WhiteSpaceClass  whiteSpaceClass = WhiteSpaceClass::Ascii) noexcept;
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns the index of the last byte of str that isn't part of a
+///   white-space, or std::string_view::npos if there's none.
+size_t FindLastNotWhiteSpace(
+    std::string_view str,
+    WhiteSpaceClass  whiteSpaceClass = WhiteSpaceClass::Ascii) noexcept;
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns the view of str without the leading and trailing white-spaces.
+std::string_view TrimWhiteSpace(
+    std::string_view str,
+    WhiteSpaceClass  whiteSpaceClass = WhiteSpaceClass::Ascii) noexcept;
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Returns str with its ends trimmed and each run of white-spaces
+///   replaced by a single space, in a single pass - the words are found
+///   and copied 16 bytes at time.
+/// @param keepNewLines
+///   If true the runs that have line feeds are replaced by them instead,
+///   so "a \r\n\r\n b" becomes "a\n\nb" (Default: false).
+/// @param whiteSpaceClass
+///   Which chars are white-spaces (Default: WhiteSpaceClass::Ascii).
+std::string NormalizeWhiteSpace(
+    std::string_view str,
+    bool             keepNewLines    = false,
+    WhiteSpaceClass  whiteSpaceClass = WhiteSpaceClass::Ascii);
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Same as NormalizeWhiteSpace but appends the result to out instead of
+///   returning a new string, so the same buffer can be reused between calls.
+void NormalizeWhiteSpaceTo(
+    std::string      &out,
+    std::string_view  str,
+    bool              keepNewLines    = false,
+    WhiteSpaceClass   whiteSpaceClass = WhiteSpaceClass::Ascii);
+
+
+namespace Private_WhiteSpace
+{
+    //--------------------------------------------------------------------------
+    // find_first_not_of / find_last_not_of that take the vectorized
+    // path when chars is the default set of the Trim functions.
+    inline bool IsDefaultSet(std::string_view chars) noexcept
+    {
+        return chars == std::string_view(kWhiteSpaceChars);
+    }
+
+    inline size_t FindFirstNotOf(std::string_view str, std::string_view chars) noexcept
+    {
+        return IsDefaultSet(chars)
+            ? FindFirstNotWhiteSpace(str)
+            : str.find_first_not_of(chars);
+    }
+
+    inline size_t FindLastNotOf(std::string_view str, std::string_view chars) noexcept
+    {
+        return IsDefaultSet(chars)
+            ? FindLastNotWhiteSpace(str)
+            : str.find_last_not_of(chars);
+    }
+}
+
+NS_CORESTRING_END
@@ -0,0 +1,174 @@
+#pragma once
+
+// std
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+// CoreString
+#include "CoreString_Utils.h"
+#include "CoreString_CaseInsensitive.h"
+
+NS_CORESTRING_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Glob pattern compiled once to be matched many times.
+///   '*' matches any sequence of chars (the empty one included) and
+///   '?' matches exactly one char, everything else matches itself.
+///
+///   The pattern is split at the '*' in literal segments: the first one
+///   must be at the start of the input, the last one at the end and the
+///   ones in between are searched in order with a Horspool searcher built
+///   at the construction (where '?' matches anything).
+class WildcardPattern
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @param pattern
+    ///   The glob pattern.
+    /// @param caseSensitive
+    ///   If the match will consider the case of the ASCII letters
+    ///   (Default: true).
+    explicit WildcardPattern(std::string_view pattern, bool caseSensitive = true);
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns true if the whole str matches the pattern.
+    bool Match(std::string_view str) const noexcept;
+
+    const std::string& Pattern      () const noexcept { return m_pattern;       }
+    bool               CaseSensitive() const noexcept { return m_caseSensitive; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   The length of the shortest string that can match the pattern.
+    size_t MinLength() const noexcept { return m_minLength; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   True if the pattern has no wildcards at all.
+    bool IsLiteral() const noexcept { return !m_hasStar && !m_hasQuestion; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   The char that every match must start with, or -1 if the
+    ///   pattern starts with a wildcard. Folded if case insensitive.
+    int FirstChar() const noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    struct Segment;
+
+    bool   MatchAt(const Segment &segment, const char *data) const noexcept;
+    size_t Search (const Segment &segment, std::string_view str, size_t begin) const noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    struct Segment
+    {
+        size_t offset; // On m_text.
+        size_t size;
+        bool   hasQuestion;
+
+        // Horspool shifts, indexed by the (folded) byte.
+        std::array<uint32_t, 256> shifts;
+    };
+
+    std::string          m_pattern;
+    std::string          m_text;      // The segments without the '*'.
+    std::vector<Segment> m_segments;
+
+    size_t m_minLength;
+    bool   m_caseSensitive;
+    bool   m_hasStar;
+    bool   m_hasQuestion;
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Set of WildcardPatterns to match the same input against all of them.
+///   The patterns without wildcards go to a hash table, so they all cost
+///   a single lookup, and the others are bucketed by the char they must
+///   start with, so only the ones that can match the input are tried.
+class WildcardSet
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    explicit WildcardSet(
+        const std::vector<std::string> &patterns,
+        bool                            caseSensitive = true);
+
+    // The literals index points to the patterns, so no copies.
+    WildcardSet(const WildcardSet &) = delete;
+    WildcardSet& operator =(const WildcardSet &) = delete;
+
+    WildcardSet(WildcardSet &&) = default;
+    WildcardSet& operator =(WildcardSet &&) = default;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns true if str matches any of the patterns.
+    bool MatchAny(std::string_view str) const noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the index (in the constructor's vector) of the first
+    ///   pattern that matches str, or std::string::npos if none does.
+    size_t FirstMatch(std::string_view str) const noexcept;
+
+    size_t Size() const noexcept { return m_patterns.size(); }
+    const WildcardPattern& operator [](size_t index) const noexcept
+    {
+        return m_patterns[index];
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    typedef std::unordered_map<
+        std::string_view,
+        size_t,
+        CaseInsensitiveHash,
+        CaseInsensitiveEqual
+    > FoldedLiterals;
+
+    std::vector<WildcardPattern> m_patterns;
+    bool                         m_caseSensitive;
+
+    // Only one of them is used, depending of the case sensitivity.
+    std::unordered_map<std::string_view, size_t> m_literals;
+    FoldedLiterals                               m_foldedLiterals;
+
+    // Indexes of the non literal patterns, sorted.
+    std::array<std::vector<size_t>, 256> m_byFirstChar;
+    std::vector<size_t>                  m_unanchored;
+};
+
+NS_CORESTRING_END
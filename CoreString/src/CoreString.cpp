@@ -5,35 +5,60 @@
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 std::string CoreString::Capitalize(const std::string &str)
 {
-    if(str.empty())
-        return str;
-
-    auto new_string = str;
-    new_string[0] = toupper(new_string[0]);
+    auto new_string = std::string();
+    CapitalizeTo(new_string, str);
 
     return new_string;
 }
 
+//------------------------------------------------------------------------------
+CORESTRING_INLINE
+void CoreString::CapitalizeTo(std::string &out, std::string_view str)
+{
+    if(str.empty())
+        return;
+
+    out.push_back(Private_Case::ToUpper(str[0]));
+    out.append(str, 1);
+}
+
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 std::string CoreString::Center(
     const std::string &str,
     size_t             length,
     char               c /* = ' ' */)
 {
-    if(str.size() >= length)
-        return str;
+    auto centered_str = std::string();
+    centered_str.reserve(std::max(str.size(), length));
+    CenterTo(centered_str, str, length, c);
+
+    return centered_str;
+}
 
-    auto total_chars = (length - str.size()) * 2;
-    auto fill_str    = std::string(total_chars, c);
+//------------------------------------------------------------------------------
+CORESTRING_INLINE
+void CoreString::CenterTo(
+    std::string      &out,
+    std::string_view  str,
+    size_t            length,
+    char              c /* = ' ' */)
+{
+    // The padding is computed only once and the odd
+    // paddings put the extra char at the right.
+    auto padding = (str.size() < length) ? (length - str.size()) : 0;
+    auto left    = padding / 2;
 
-    return fill_str + str + fill_str;
+    out.append(left, c).append(str).append(padding - left, c);
 }
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 size_t CoreString::Count(
     const std::string &haystack,
     const std::string &needle,
@@ -41,8 +66,8 @@ size_t CoreString::Count(
     size_t             end   /* = std::string::npos */)
 {
     COREASSERT_ASSERT(
-        start >= 0 && start < haystack.size(),
-        "start(%d) index isn't in haystack(%s) bounds[0, %d)",
+        start < haystack.size(),
+        "start(%zu) index isn't in haystack(%s) bounds[0, %zu)",
         start,
         haystack.c_str(),
         haystack.size()
@@ -80,16 +105,41 @@ size_t CoreString::Count(
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 std::string CoreString::ExpandTabs(
     const std::string &str,
     size_t             tabSize /* = 8 */)
 {
-    auto spaces = std::string(tabSize, ' ');
-    return CoreString::Replace(str, "\t", spaces);
+    auto expanded_str = std::string();
+    ExpandTabsTo(expanded_str, str, tabSize);
+
+    return expanded_str;
+}
+
+//------------------------------------------------------------------------------
+CORESTRING_INLINE
+void CoreString::ExpandTabsTo(
+    std::string      &out,
+    std::string_view  str,
+    size_t            tabSize /* = 8 */)
+{
+    auto index = size_t(0);
+    while(true)
+    {
+        auto tab_index = str.find('\t', index);
+        if(tab_index == std::string_view::npos)
+            break;
+
+        out.append(str, index, tab_index - index).append(tabSize, ' ');
+        index = tab_index + 1;
+    }
+
+    out.append(str, index);
 }
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 bool CoreString::IsAlNum(const std::string &str)
 {
     if(str.empty())
@@ -108,6 +158,7 @@ bool CoreString::IsAlNum(const std::string &str)
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 bool CoreString::IsAlpha(const std::string &str)
 {
     if(str.empty())
@@ -125,7 +176,8 @@ bool CoreString::IsAlpha(const std::string &str)
 }
 
 //------------------------------------------------------------------------------
-bool IsDigit(const std::string &str)
+CORESTRING_INLINE
+bool CoreString::IsDigit(const std::string &str)
 {
     if(str.empty())
         return false;
@@ -143,6 +195,7 @@ bool IsDigit(const std::string &str)
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 bool CoreString::IsLower(const std::string &str)
 {
     if(str.empty())
@@ -160,32 +213,27 @@ bool CoreString::IsLower(const std::string &str)
 }
 
 //------------------------------------------------------------------------------
-bool IsSpace(const std::string &str)
+CORESTRING_INLINE
+bool CoreString::IsSpace(const std::string &str)
 {
     if(str.empty())
         return false;
 
-    auto it = std::find_if_not(
-        std::begin(str),
-        std::end(str),
-        [](const char c){
-            return isspace(c);
-        }
-    );
-
-    return it != std::end(str);
+    return FindFirstNotWhiteSpace(str) == std::string_view::npos;
 }
 
-
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 bool CoreString::IsTitle(const std::string &str)
 {
     //COWTODO(n2omatt): implemnet...
+    (void)str;
     return false;
 }
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 bool CoreString::IsUpper(const std::string &str)
 {
     if(str.empty())
@@ -204,51 +252,62 @@ bool CoreString::IsUpper(const std::string &str)
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 std::string CoreString::SwapCase(const std::string &str)
 {
-    auto new_string = str;
-    std::transform(
-        std::begin(new_string),
-        std::end(new_string),
-        std::begin(new_string),
-        [](const char c){
-            return (isupper(c)) ? tolower(c) : toupper(c);
-        }
-    );
+    auto new_string = std::string();
+    SwapCaseTo(new_string, str);
 
     return new_string;
 }
 
+//------------------------------------------------------------------------------
+CORESTRING_INLINE
+void CoreString::SwapCaseTo(std::string &out, std::string_view str)
+{
+    auto start = out.size();
+    out.append(str);
+
+    std::transform(
+        std::begin(out) + start,
+        std::end  (out),
+        std::begin(out) + start,
+        Private_Case::SwapCase
+    );
+}
+
 
 //------------------------------------------------------------------------------
 /// @brief
 ///   Return a titlecased version of S, i.e. words start with uppercase
 ///   characters, all remaining cased characters have lowercase.
+CORESTRING_INLINE
 std::string CoreString::Title(const std::string &str)
 {
-    if(str.empty())
-        return str;
-
-    auto title_str  = str;
-    auto need_upper = true;
-
-    for(auto &c : title_str)
-    {
-        if(need_upper)
-        {
-            c = toupper(c);
-            need_upper = false;
-
-            continue;
-        }
-
-        c = tolower(c);
-    }
+    auto title_str = std::string();
+    TitleTo(title_str, str);
 
     return title_str;
 }
 
+//------------------------------------------------------------------------------
+CORESTRING_INLINE
+void CoreString::TitleTo(std::string &out, std::string_view str)
+{
+    if(str.empty())
+        return;
 
+    auto start = out.size();
+    out.append(str);
+
+    out[start] = Private_Case::ToUpper(out[start]);
+    std::transform(
+        std::begin(out) + start + 1,
+        std::end  (out),
+        std::begin(out) + start + 1,
+        Private_Case::ToLower
+    );
+}
 
 
 //------------------------------------------------------------------------------
@@ -258,6 +317,7 @@ std::string CoreString::Title(const std::string &str)
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 bool CoreString::Contains(
     const std::string &haystack,
     const std::string &needle,
@@ -268,14 +328,18 @@ bool CoreString::Contains(
         return haystack.find(needle) != std::string::npos;
 
     // Case insensitive case, need to convert the strings.
-    auto lower_haystack = ToLower(haystack);
-    auto lower_needle   = ToLower(needle);
+    //   The lowered copies go to pooled buffers.
+    Private_Scratch::ScratchString lower_haystack;
+    Private_Scratch::ScratchString lower_needle;
+    ToLowerTo(*lower_haystack, haystack);
+    ToLowerTo(*lower_needle,   needle);
 
-    return lower_haystack.find(lower_needle) != std::string::npos;
+    return lower_haystack->find(*lower_needle) != std::string::npos;
 }
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 bool CoreString::EndsWith(
     const std::string &haystack,
     const std::string &needle,
@@ -303,6 +367,7 @@ bool CoreString::EndsWith(
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 size_t CoreString::IndexOf(
     const std::string &str,
     char               c,
@@ -333,6 +398,7 @@ size_t CoreString::IndexOf(
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 size_t CoreString::IndexOfAny(
     const std::string &str,
     const std::string &chars,
@@ -343,33 +409,20 @@ size_t CoreString::IndexOfAny(
     if(beginIndex + charsCount > str.size())
         charsCount = (str.size() - beginIndex);
 
-    //--------------------------------------------------------------------------
-    // COWTODO(n2omatt): How we gonna check for all the characters
-    //   in the chars string but still respecting the range to be
-    //   searched in the str?
-    //
-    //   The std functions (for what I know now) doesn't provide
-    //   this functionality out of the box, so to the sake of
-    //   continue the project I'm working on a naive, and
-    //   non perfomatic approach is used now.
-    //
-    //   Fix this soon as possible.
-
-    // I'm creating a copy of string now to make the find_first_of
-    // respect the range of str. This is not OK, check the comment
-    // above.
-    auto temp = std::string(str, beginIndex, charsCount);
-    return temp.find_first_of(chars.c_str());
+    // A view of the range, so find_first_of respects it without a copy.
+    auto range = std::string_view(str).substr(beginIndex, charsCount);
+    return range.find_first_of(chars);
 }
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 bool CoreString::IsNullOrWhiteSpace(const std::string &str)
 {
     if(str.empty())
         return true;
 
-    return str.find_first_not_of(' ') == std::string::npos;
+    return FindFirstNotWhiteSpace(str) == std::string_view::npos;
 }
 
 
@@ -383,6 +436,7 @@ bool CoreString::IsNullOrWhiteSpace(const std::string &str)
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 size_t CoreString::LastIndexOf(
     const std::string &str,
     char               c,
@@ -399,22 +453,21 @@ size_t CoreString::LastIndexOf(
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 size_t CoreString::LastIndexOfAny(
     const std::string &str,
     const std::string &chars,
     size_t             beginIndex /* = 0                 */,
     size_t             charsCount /* = std::string::npos */)
 {
-    // Clamp the range.
-    if(beginIndex + charsCount > str.size())
-        charsCount = (str.size() - beginIndex);
-
-    auto search_str = str.substr(beginIndex, charsCount);
-    return str.find_last_of(chars.c_str());
+    // A view of the range, so find_last_of respects it without a copy.
+    auto range = std::string_view(str).substr(beginIndex, charsCount);
+    return range.find_last_of(chars);
 }
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 std::string CoreString::PadLeft(
     const std::string &str,
     size_t             length,
@@ -424,11 +477,30 @@ std::string CoreString::PadLeft(
     if(str.size() >= length)
         return str;
 
-    return std::string(length - str.size(), c) + str;
+    auto padded_str = std::string();
+    padded_str.reserve(length);
+    PadLeftTo(padded_str, str, length, c);
+
+    return padded_str;
+}
+
+//------------------------------------------------------------------------------
+CORESTRING_INLINE
+void CoreString::PadLeftTo(
+    std::string      &out,
+    std::string_view  str,
+    size_t            length,
+    char              c /* = ' ' */)
+{
+    if(str.size() < length)
+        out.append(length - str.size(), c);
+
+    out.append(str);
 }
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 std::string CoreString::PadRight(
     const std::string &str,
     size_t             length,
@@ -438,38 +510,76 @@ std::string CoreString::PadRight(
     if(str.size() >= length)
         return str;
 
-    return str + std::string(length - str.size(), c);
+    auto padded_str = std::string();
+    padded_str.reserve(length);
+    PadRightTo(padded_str, str, length, c);
+
+    return padded_str;
+}
+
+//------------------------------------------------------------------------------
+CORESTRING_INLINE
+void CoreString::PadRightTo(
+    std::string      &out,
+    std::string_view  str,
+    size_t            length,
+    char              c /* = ' ' */)
+{
+    out.append(str);
+
+    if(str.size() < length)
+        out.append(length - str.size(), c);
 }
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 std::string CoreString::Replace(
     const std::string &str,
     const std::string &what,
     const std::string &to)
 {
-    // Make a copy, so we can modify it.
-    auto new_string = str;
+    auto new_string = std::string();
+    new_string.reserve(str.size());
+    ReplaceTo(new_string, str, what, to);
 
-    // Keep searching and replacing the contents of string
-    // until we haven't anything to replace.
-    while(true)
+    return new_string;
+}
+
+//------------------------------------------------------------------------------
+CORESTRING_INLINE
+void CoreString::ReplaceTo(
+    std::string      &out,
+    std::string_view  str,
+    std::string_view  what,
+    std::string_view  to)
+{
+    // Nothing to search, avoid looping forever.
+    if(what.empty())
     {
-        auto index = new_string.find(what);
+        out.append(str);
+        return;
+    }
 
-        // We haven't found anything so there's no
-        // meaning to continue searching.
-        if(index == std::string::npos)
+    // Walk the string only once, copying the chunks between the
+    // matches, so the replaced text is never searched again.
+    auto index = size_t(0);
+    while(true)
+    {
+        auto found = str.find(what, index);
+        if(found == std::string_view::npos)
             break;
 
-        new_string.replace(index, what.size(), to);
+        out.append(str, index, found - index).append(to);
+        index = found + what.size();
     }
 
-    return new_string;
+    out.append(str, index);
 }
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 std::vector<std::string> CoreString::Split(
     const std::string &str,
     const std::string &chars)
@@ -493,12 +603,14 @@ std::vector<std::string> CoreString::Split(
 }
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 std::vector<std::string> CoreString::Split(const std::string &str, char c)
 {
     return CoreString::Split(str, std::string(1, c));
 }
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 bool CoreString::StartsWith(
     const std::string &haystack,
     const std::string &needle,
@@ -522,79 +634,135 @@ bool CoreString::StartsWith(
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 std::string CoreString::ToLower(const std::string &str)
 {
-    auto lower_str = str;
-    std::transform(
-        std::begin(lower_str),
-        std::end  (lower_str),
-        std::begin(lower_str),
-        [](char c){
-            return tolower(c);
-        }
-    );
+    auto lower_str = std::string();
+    ToLowerTo(lower_str, str);
 
     return lower_str;
 }
 
-
 //------------------------------------------------------------------------------
-std::string CoreString::ToUpper(const std::string &str)
+CORESTRING_INLINE
+void CoreString::ToLowerTo(std::string &out, std::string_view str)
 {
-    auto upper_str = str;
+    auto start = out.size();
+    out.append(str);
+
     std::transform(
-        std::begin(upper_str),
-        std::end  (upper_str),
-        std::begin(upper_str),
-        [](char c){
-            return toupper(c);
-        }
+        std::begin(out) + start,
+        std::end  (out),
+        std::begin(out) + start,
+        Private_Case::ToLower
     );
+}
+
+
+//------------------------------------------------------------------------------
+CORESTRING_INLINE
+std::string CoreString::ToUpper(const std::string &str)
+{
+    auto upper_str = std::string();
+    ToUpperTo(upper_str, str);
 
     return upper_str;
 }
 
+//------------------------------------------------------------------------------
+CORESTRING_INLINE
+void CoreString::ToUpperTo(std::string &out, std::string_view str)
+{
+    auto start = out.size();
+    out.append(str);
+
+    std::transform(
+        std::begin(out) + start,
+        std::end  (out),
+        std::begin(out) + start,
+        Private_Case::ToUpper
+    );
+}
+
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 std::string CoreString::Trim(
     const std::string &str,
-    const std::string &chars /* = " " */)
+    const std::string &chars /* = kWhiteSpaceChars */)
 {
-    if(str.empty())
-        return str;
+    auto trimmed_str = std::string();
+    TrimTo(trimmed_str, str, chars);
 
-    auto begin = str.find_first_not_of(chars);
-    if(begin == std::string::npos)
-        return "";
+    return trimmed_str;
+}
 
-    auto end = str.find_last_not_of (chars);
-    if(end == std::string::npos)
-        return "";
+//------------------------------------------------------------------------------
+CORESTRING_INLINE
+void CoreString::TrimTo(
+    std::string      &out,
+    std::string_view  str,
+    std::string_view  chars /* = kWhiteSpaceChars */)
+{
+    auto begin = Private_WhiteSpace::FindFirstNotOf(str, chars);
+    if(begin == std::string_view::npos)
+        return;
 
-    return str.substr(begin, end-begin +1);
+    auto end = Private_WhiteSpace::FindLastNotOf(str, chars);
+    out.append(str, begin, end - begin + 1);
 }
 
 
 //------------------------------------------------------------------------------
+CORESTRING_INLINE
 std::string CoreString::TrimEnd(
     const std::string &str,
-    const std::string &chars /* = " " */)
+    const std::string &chars /* = kWhiteSpaceChars */)
 {
-    auto end = str.find_last_not_of(chars);
-    return str.substr(0, end+1);
+    auto trimmed_str = std::string();
+    TrimEndTo(trimmed_str, str, chars);
+
+    return trimmed_str;
 }
 
+//------------------------------------------------------------------------------
+CORESTRING_INLINE
+void CoreString::TrimEndTo(
+    std::string      &out,
+    std::string_view  str,
+    std::string_view  chars /* = kWhiteSpaceChars */)
+{
+    auto end = Private_WhiteSpace::FindLastNotOf(str, chars);
+    if(end == std::string_view::npos)
+        return;
 
-//-----------------------------------------------------------------------------
+    out.append(str, 0, end + 1);
+}
+
+
+//------------------------------------------------------------------------------
+CORESTRING_INLINE
 std::string CoreString::TrimStart(
     const std::string &str,
-    const std::string &chars /* = " " */)
+    const std::string &chars /* = kWhiteSpaceChars */)
 {
-    auto start = str.find_first_not_of(chars);
+    auto trimmed_str = std::string();
+    TrimStartTo(trimmed_str, str, chars);
 
+    return trimmed_str;
+}
+
+//------------------------------------------------------------------------------
+CORESTRING_INLINE
+void CoreString::TrimStartTo(
+    std::string      &out,
+    std::string_view  str,
+    std::string_view  chars /* = kWhiteSpaceChars */)
+{
     // All chars should be trimmed.
-    if(start == std::string::npos)
-        return "";
+    auto start = Private_WhiteSpace::FindFirstNotOf(str, chars);
+    if(start == std::string_view::npos)
+        return;
 
-    return str.substr(start);
+    out.append(str, start);
 }
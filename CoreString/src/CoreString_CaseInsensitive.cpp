@@ -0,0 +1,318 @@
+// Header
+#include "../include/CoreString_CaseInsensitive.h"
+// std
+#include <algorithm>
+// CoreString
+#include "CoreString_Simd.h"
+
+using namespace CoreString::Private_Simd;
+
+
+//------------------------------------------------------------------------------
+// Helper Functions.
+namespace {
+
+constexpr uint64_t kHashMultiplier = 0x9E3779B97F4A7C15ULL;
+
+// Code points given to the bytes of invalid UTF-8 sequences,
+// so they don't collide with any valid code point.
+constexpr uint32_t kInvalidCodePoint = 0x110000;
+
+//------------------------------------------------------------------------------
+inline int CompareFolded(char lhs, char rhs) noexcept
+{
+    return int((unsigned char)FoldAscii(lhs)) - int((unsigned char)FoldAscii(rhs));
+}
+
+inline uint64_t Mix(uint64_t hash, uint64_t value) noexcept
+{
+    hash ^= value;
+    hash *= kHashMultiplier;
+    hash ^= (hash >> 32);
+
+    return hash;
+}
+
+inline size_t Finish(uint64_t hash) noexcept
+{
+    hash *= kHashMultiplier;
+    return size_t(hash ^ (hash >> 29));
+}
+
+//------------------------------------------------------------------------------
+// Decodes the code point at data and returns how many bytes it takes.
+// Invalid sequences take one byte and decode to kInvalidCodePoint + byte.
+size_t DecodeUtf8(const char *data, size_t size, uint32_t &codePoint) noexcept
+{
+    auto bytes = reinterpret_cast<const unsigned char *>(data);
+    auto lead  = bytes[0];
+
+    auto length = size_t(0);
+    auto value  = uint32_t(0);
+    auto min    = uint32_t(0);
+
+         if(lead < 0x80)           { codePoint = lead; return 1; }
+    else if((lead & 0xE0) == 0xC0) { length = 2; value = lead & 0x1F; min = 0x80;    }
+    else if((lead & 0xF0) == 0xE0) { length = 3; value = lead & 0x0F; min = 0x800;   }
+    else if((lead & 0xF8) == 0xF0) { length = 4; value = lead & 0x07; min = 0x10000; }
+
+    if(length == 0 || length > size)
+    {
+        codePoint = kInvalidCodePoint + lead;
+        return 1;
+    }
+
+    for(auto i = size_t(1); i < length; ++i)
+    {
+        if((bytes[i] & 0xC0) != 0x80)
+        {
+            codePoint = kInvalidCodePoint + lead;
+            return 1;
+        }
+        value = (value << 6) | (bytes[i] & 0x3F);
+    }
+
+    // Overlong encodings and out of range values are invalid as well.
+    if(value < min || value > 0x10FFFF)
+    {
+        codePoint = kInvalidCodePoint + lead;
+        return 1;
+    }
+
+    codePoint = value;
+    return length;
+}
+
+//------------------------------------------------------------------------------
+// Simple case folding of the Latin-1, Latin Extended-A, Greek and Cyrillic
+// letters. Every mapping here keeps the UTF-8 length of the code point.
+uint32_t FoldCodePoint(uint32_t cp) noexcept
+{
+    if(cp < 0x80)
+        return uint32_t(FoldAscii(char(cp)));
+
+    // Latin-1 Supplement - 0xD7 is the multiplication sign.
+    if(cp >= 0xC0 && cp <= 0xDE && cp != 0xD7)
+        return cp + 0x20;
+
+    // Latin Extended-A.
+    if(cp >= 0x100 && cp <= 0x17F)
+    {
+        if(cp == 0x130 || cp == 0x131 || cp == 0x138 || cp == 0x149 || cp == 0x17F)
+            return cp;
+        if(cp == 0x178)
+            return 0xFF;
+
+        auto odd_upper = (cp >= 0x139 && cp <= 0x148) || (cp >= 0x179 && cp <= 0x17E);
+        if(odd_upper)
+            return (cp & 1) ? cp + 1 : cp;
+
+        return (cp & 1) ? cp : cp + 1;
+    }
+
+    // Greek.
+    if(cp >= 0x391 && cp <= 0x3A9 && cp != 0x3A2) return cp + 0x20;
+    if(cp >= 0x388 && cp <= 0x38A)                return cp + 0x25;
+    if(cp == 0x38E || cp == 0x38F)                return cp + 0x3F;
+    if(cp == 0x386)                               return 0x3AC;
+    if(cp == 0x38C)                               return 0x3CC;
+    if(cp == 0x3C2)                               return 0x3C3; // Final sigma.
+
+    // Cyrillic.
+    if(cp >= 0x400 && cp <= 0x40F) return cp + 0x50;
+    if(cp >= 0x410 && cp <= 0x42F) return cp + 0x20;
+
+    auto paired = (cp >= 0x460 && cp <= 0x481) || (cp >= 0x48A && cp <= 0x4BF);
+    if(paired && (cp & 1) == 0)
+        return cp + 1;
+
+    return cp;
+}
+
+//------------------------------------------------------------------------------
+// Compares the ASCII folded bytes of lhs and rhs in [index, size) while
+// they're equal. Returns the index of the first difference (or size).
+// When asciiOnly is set it stops as well at the first block that has
+// a non ASCII byte in any of strings, returning its start.
+size_t MatchFoldedAscii(
+    const char *lhs,
+    const char *rhs,
+    size_t      index,
+    size_t      size,
+    bool        asciiOnly) noexcept
+{
+#if CORESTRING_HAS_SSE2
+    while(index + 16 <= size)
+    {
+        auto a = Load16(lhs + index);
+        auto b = Load16(rhs + index);
+        if(asciiOnly && Mask16(_mm_or_si128(a, b)) != 0)
+            return index;
+
+        auto equal = Mask16(_mm_cmpeq_epi8(FoldAscii16(a), FoldAscii16(b)));
+        if(equal != 0xFFFF)
+            return index + FirstSetBit(~equal);
+
+        index += 16;
+    }
+#endif // CORESTRING_HAS_SSE2
+
+    while(index + 8 <= size)
+    {
+        auto a = LoadWord(lhs + index);
+        auto b = LoadWord(rhs + index);
+        if(asciiOnly && !IsAsciiWord(a | b))
+            return index;
+
+        auto diff = FoldAsciiWord(a) ^ FoldAsciiWord(b);
+        if(diff != 0)
+            return index + FirstFlaggedByte(diff);
+
+        index += 8;
+    }
+
+    if(asciiOnly)
+        return index;
+
+    while(index < size && FoldAscii(lhs[index]) == FoldAscii(rhs[index]))
+        ++index;
+
+    return index;
+}
+
+//------------------------------------------------------------------------------
+// Compares the folded code points of both strings until the first
+// difference, returning its sign - or zero if the shortest string
+// is a prefix of the other.
+int CompareUtf8(std::string_view lhs, std::string_view rhs) noexcept
+{
+    auto size  = std::min(lhs.size(), rhs.size());
+    auto index = size_t(0);
+
+    while(index < size)
+    {
+        // Skip the ASCII runs in blocks.
+        index = MatchFoldedAscii(lhs.data(), rhs.data(), index, size, true);
+        if(index >= size)
+            break;
+
+        auto lhs_cp     = uint32_t(0);
+        auto rhs_cp     = uint32_t(0);
+        auto lhs_length = DecodeUtf8(lhs.data() + index, lhs.size() - index, lhs_cp);
+        auto rhs_length = DecodeUtf8(rhs.data() + index, rhs.size() - index, rhs_cp);
+
+        lhs_cp = FoldCodePoint(lhs_cp);
+        rhs_cp = FoldCodePoint(rhs_cp);
+        if(lhs_cp != rhs_cp)
+            return (lhs_cp < rhs_cp) ? -1 : 1;
+
+        // Equal folded code points always have the same length.
+        index += std::min(lhs_length, rhs_length);
+    }
+
+    return 0;
+}
+
+} // Anonymous namespace.
+
+
+//------------------------------------------------------------------------------
+bool CoreString::EqualsIgnoreCase(
+    std::string_view lhs,
+    std::string_view rhs) noexcept
+{
+    if(lhs.size() != rhs.size())
+        return false;
+
+    auto index = MatchFoldedAscii(lhs.data(), rhs.data(), 0, lhs.size(), false);
+    return index == lhs.size();
+}
+
+//------------------------------------------------------------------------------
+int CoreString::CompareIgnoreCase(
+    std::string_view lhs,
+    std::string_view rhs) noexcept
+{
+    auto size  = std::min(lhs.size(), rhs.size());
+    auto index = MatchFoldedAscii(lhs.data(), rhs.data(), 0, size, false);
+
+    if(index < size)
+        return CompareFolded(lhs[index], rhs[index]);
+
+    if(lhs.size() == rhs.size())
+        return 0;
+
+    return (lhs.size() < rhs.size()) ? -1 : 1;
+}
+
+//------------------------------------------------------------------------------
+size_t CoreString::HashIgnoreCase(std::string_view str) noexcept
+{
+    auto hash  = uint64_t(str.size()) * kHashMultiplier;
+    auto index = size_t(0);
+
+    for(; index + 8 <= str.size(); index += 8)
+        hash = Mix(hash, FoldAsciiWord(LoadWord(str.data() + index)));
+
+    if(index < str.size())
+    {
+        auto word = LoadPartialWord(str.data() + index, str.size() - index);
+        hash = Mix(hash, FoldAsciiWord(word));
+    }
+
+    return Finish(hash);
+}
+
+
+//------------------------------------------------------------------------------
+bool CoreString::EqualsIgnoreCaseUtf8(
+    std::string_view lhs,
+    std::string_view rhs) noexcept
+{
+    // The folding keeps the lengths, so different sizes can't be equal.
+    if(lhs.size() != rhs.size())
+        return false;
+
+    return CompareUtf8(lhs, rhs) == 0;
+}
+
+//------------------------------------------------------------------------------
+int CoreString::CompareIgnoreCaseUtf8(
+    std::string_view lhs,
+    std::string_view rhs) noexcept
+{
+    auto result = CompareUtf8(lhs, rhs);
+    if(result != 0 || lhs.size() == rhs.size())
+        return result;
+
+    return (lhs.size() < rhs.size()) ? -1 : 1;
+}
+
+//------------------------------------------------------------------------------
+size_t CoreString::HashIgnoreCaseUtf8(std::string_view str) noexcept
+{
+    auto hash  = uint64_t(str.size()) * kHashMultiplier;
+    auto index = size_t(0);
+
+    // Strings that are EqualsIgnoreCaseUtf8 have the ASCII and non ASCII
+    // chars at the same positions, so they're split in the same pieces.
+    while(index < str.size())
+    {
+        if(index + 8 <= str.size())
+        {
+            auto word = LoadWord(str.data() + index);
+            if(IsAsciiWord(word))
+            {
+                hash   = Mix(hash, FoldAsciiWord(word));
+                index += 8;
+                continue;
+            }
+        }
+
+        auto cp = uint32_t(0);
+        index += DecodeUtf8(str.data() + index, str.size() - index, cp);
+        hash   = Mix(hash, FoldCodePoint(cp));
+    }
+
+    return Finish(hash);
+}
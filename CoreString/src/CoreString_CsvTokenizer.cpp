@@ -0,0 +1,206 @@
+// Header
+#include "../include/CoreString_CsvTokenizer.h"
+// CoreString
+#include "CoreString_Simd.h"
+
+using namespace CoreString::Private_Simd;
+
+
+//------------------------------------------------------------------------------
+// Helper Functions.
+namespace {
+
+constexpr size_t kBlockSize = 64;
+
+struct BlockMasks
+{
+    uint64_t quotes;
+    uint64_t delimiters;
+    uint64_t newlines;
+};
+
+//------------------------------------------------------------------------------
+// Bit i of the result is the xor of the bits [0, i] of mask, so every
+// bit between a opening and closing quote (the opening one included)
+// is set. Two escaped quotes flip it twice, leaving it as it was.
+inline uint64_t PrefixXor(uint64_t mask) noexcept
+{
+    mask ^= (mask << 1);
+    mask ^= (mask << 2);
+    mask ^= (mask << 4);
+    mask ^= (mask << 8);
+    mask ^= (mask << 16);
+    mask ^= (mask << 32);
+
+    return mask;
+}
+
+//------------------------------------------------------------------------------
+// Masks of the 64 bytes at data.
+BlockMasks FindStructurals(const char *data, char delimiter, char quote) noexcept
+{
+    auto masks = BlockMasks{0, 0, 0};
+
+#if CORESTRING_HAS_SSE2
+    auto quote_v     = _mm_set1_epi8(quote);
+    auto delimiter_v = _mm_set1_epi8(delimiter);
+    auto newline_v   = _mm_set1_epi8('\n');
+
+    for(auto i = size_t(0); i < kBlockSize; i += 16)
+    {
+        auto v = Load16(data + i);
+        masks.quotes     |= uint64_t(Mask16(_mm_cmpeq_epi8(v, quote_v    ))) << i;
+        masks.delimiters |= uint64_t(Mask16(_mm_cmpeq_epi8(v, delimiter_v))) << i;
+        masks.newlines   |= uint64_t(Mask16(_mm_cmpeq_epi8(v, newline_v  ))) << i;
+    }
+#else
+    for(auto i = size_t(0); i < kBlockSize; ++i)
+    {
+        masks.quotes     |= uint64_t(data[i] == quote    ) << i;
+        masks.delimiters |= uint64_t(data[i] == delimiter) << i;
+        masks.newlines   |= uint64_t(data[i] == '\n'     ) << i;
+    }
+#endif // CORESTRING_HAS_SSE2
+
+    return masks;
+}
+
+} // Anonymous namespace.
+
+
+//------------------------------------------------------------------------------
+CoreString::CsvTokenizer::CsvTokenizer(
+    std::string_view input,
+    char             delimiter /* = ',' */,
+    char             quote     /* = '"' */) :
+    m_input    (input),
+    m_delimiter(delimiter),
+    m_quote    (quote),
+    m_position (0)
+{
+    // Empty...
+}
+
+
+//------------------------------------------------------------------------------
+bool CoreString::CsvTokenizer::NextRecord(std::vector<std::string_view> &fields)
+{
+    fields.clear();
+    if(m_position >= m_input.size())
+        return false;
+
+    m_spans.clear();
+    m_unescapeBuffer.clear();
+
+    auto field_begin = m_position;
+    auto block_begin = m_position;
+    auto in_quotes   = uint64_t(0); // All ones when a block starts quoted.
+    auto line_ended  = false;
+
+    while(!line_ended && block_begin < m_input.size())
+    {
+        // The last block is copied to a zeroed buffer,
+        // so we never read past the end of the input.
+        auto data      = m_input.data() + block_begin;
+        auto remaining = m_input.size() - block_begin;
+
+        char padded[kBlockSize] = {};
+        if(remaining < kBlockSize)
+        {
+            std::memcpy(padded, data, remaining);
+            data = padded;
+        }
+
+        auto masks  = FindStructurals(data, m_delimiter, m_quote);
+        auto quoted = PrefixXor(masks.quotes) ^ in_quotes;
+
+        auto structurals = (masks.delimiters | masks.newlines) & ~quoted;
+        while(structurals != 0)
+        {
+            auto bit   = FirstSetBit64(structurals);
+            auto index = block_begin + bit;
+
+            line_ended = ((masks.newlines >> bit) & 1) != 0;
+            AddField(field_begin, index, line_ended);
+
+            field_begin = index + 1;
+            if(line_ended)
+                break;
+
+            structurals &= (structurals - 1);
+        }
+
+        // Carry the quote state to the next block.
+        in_quotes    = uint64_t(0) - (quoted >> 63);
+        block_begin += kBlockSize;
+    }
+
+    // The input ended without a line break - its end is the line end,
+    // so a trailing '\r' is dropped as well.
+    if(!line_ended)
+    {
+        AddField(field_begin, m_input.size(), true);
+        field_begin = m_input.size();
+    }
+
+    m_position = field_begin;
+
+    // Only now the unescape buffer is done growing,
+    // so the views to it can be taken.
+    fields.reserve(m_spans.size());
+    for(const auto &span : m_spans)
+    {
+        auto base = (span.unescaped) ? m_unescapeBuffer.data() : m_input.data();
+        fields.emplace_back(base + span.offset, span.size);
+    }
+
+    return true;
+}
+
+
+//------------------------------------------------------------------------------
+void CoreString::CsvTokenizer::AddField(size_t begin, size_t end, bool endsLine)
+{
+    // Windows line breaks.
+    if(endsLine && end > begin && m_input[end - 1] == '\r')
+        --end;
+
+    // Unquoted field, as is.
+    if(begin == end || m_input[begin] != m_quote)
+    {
+        m_spans.push_back(Span{begin, end - begin, false});
+        return;
+    }
+
+    // Quoted field - drop the enclosing quotes. Anything after the
+    // closing quote is malformed but we keep it, as most readers do.
+    ++begin;
+    auto field = m_input.substr(begin, end - begin);
+    if(!field.empty() && field.back() == m_quote)
+        field.remove_suffix(1);
+
+    auto first_quote = field.find(m_quote);
+    if(first_quote == std::string_view::npos)
+    {
+        m_spans.push_back(Span{begin, field.size(), false});
+        return;
+    }
+
+    // Has escaped quotes, so it needs a copy without them.
+    auto offset = m_unescapeBuffer.size();
+    auto index  = size_t(0);
+    while(first_quote != std::string_view::npos)
+    {
+        // Keep one quote of the pair.
+        m_unescapeBuffer.append(field, index, first_quote + 1 - index);
+
+        index = first_quote + 1;
+        if(index < field.size() && field[index] == m_quote)
+            ++index;
+
+        first_quote = field.find(m_quote, index);
+    }
+    m_unescapeBuffer.append(field, index);
+
+    m_spans.push_back(Span{offset, m_unescapeBuffer.size() - offset, true});
+}
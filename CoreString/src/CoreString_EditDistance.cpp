@@ -0,0 +1,242 @@
+// Header
+#include "../include/CoreString_EditDistance.h"
+// std
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+// Helper Functions.
+namespace {
+
+constexpr size_t kWordBits = 64;
+
+enum class Mode
+{
+    Levenshtein, // Global distance.
+    Damerau,     // Global distance with transpositions.
+    Search       // Pattern may start anywhere in the text.
+};
+
+//------------------------------------------------------------------------------
+// The vertical deltas of 64 rows of the current column, as in Myers' paper:
+// pv/mv have the rows where the delta is +1/-1. The previous column's d0
+// (zero diagonal deltas) and eq are kept for the transpositions.
+struct Block
+{
+    uint64_t pv;
+    uint64_t mv;
+    uint64_t d0;
+    uint64_t eq;
+};
+
+//------------------------------------------------------------------------------
+// Advances one block to the next column.
+//   hin is the horizontal delta entering the block's top, the returned
+//   value is the one leaving its highest row. trCarry is the transposition
+//   bit flowing from the block below (in and out).
+inline int AdvanceBlock(
+    Block    &block,
+    uint64_t  eq,
+    int       hin,
+    uint64_t  highBit,
+    bool      damerau,
+    uint64_t &trCarry) noexcept
+{
+    auto pv       = block.pv;
+    auto mv       = block.mv;
+    auto eq_chars = eq;
+
+    auto tr = uint64_t(0);
+    if(damerau)
+    {
+        auto candidates = (~block.d0) & eq;
+        tr      = ((candidates << 1) | trCarry) & block.eq;
+        trCarry = candidates >> (kWordBits - 1);
+    }
+
+    auto xv = eq | mv | tr;
+    if(hin < 0)
+        eq |= 1;
+
+    auto xh = ((((eq & pv) + pv) ^ pv) | eq) | tr;
+    auto ph = mv | ~(xh | pv);
+    auto mh = pv & xh;
+
+    auto hout = 0;
+    if(ph & highBit) hout = +1;
+    if(mh & highBit) hout = -1;
+
+    ph <<= 1;
+    mh <<= 1;
+         if(hin < 0) mh |= 1;
+    else if(hin > 0) ph |= 1;
+
+    block.pv = mh | ~(xv | ph);
+    block.mv = ph & xv;
+    block.d0 = xh | xv;
+    block.eq = eq_chars;
+
+    return hout;
+}
+
+//------------------------------------------------------------------------------
+// Runs the pattern against the text, with pattern on the bit vectors.
+//   For the distance modes returns the distance (or maxScore + 1 if it
+//   can't be within maxScore), for the search returns the index past
+//   the end of the first match (or npos).
+size_t Run(
+    std::string_view pattern,
+    std::string_view text,
+    size_t           maxScore,
+    Mode             mode,
+    uint64_t        *peq,
+    Block           *blocks)
+{
+    auto size         = pattern.size();
+    auto blocks_count = (size + kWordBits - 1) / kWordBits;
+    auto high_bit     = uint64_t(1) << ((size - 1) % kWordBits);
+    auto damerau      = (mode == Mode::Damerau);
+
+    //--------------------------------------------------------------------------
+    // Pattern match vectors - bit i of peq[c][block] is set
+    // if the char i of that block is c.
+    std::memset(peq, 0, 256 * blocks_count * sizeof(uint64_t));
+    for(auto i = size_t(0); i < size; ++i)
+    {
+        auto c = uint8_t(pattern[i]);
+        peq[c * blocks_count + i / kWordBits] |= uint64_t(1) << (i % kWordBits);
+    }
+
+    for(auto b = size_t(0); b < blocks_count; ++b)
+        blocks[b] = Block{~uint64_t(0), 0, 0, 0};
+
+    //--------------------------------------------------------------------------
+    // Column by column. The score is D[size][j].
+    auto score = size;
+    auto hin0  = (mode == Mode::Search) ? 0 : +1;
+
+    for(auto j = size_t(0); j < text.size(); ++j)
+    {
+        auto column   = peq + uint8_t(text[j]) * blocks_count;
+        auto hin      = hin0;
+        auto tr_carry = uint64_t(0);
+
+        for(auto b = size_t(0); b < blocks_count; ++b)
+        {
+            auto high = (b + 1 == blocks_count) ? high_bit : (uint64_t(1) << 63);
+            hin = AdvanceBlock(blocks[b], column[b], hin, high, damerau, tr_carry);
+        }
+
+        score += hin;
+
+        if(mode == Mode::Search)
+        {
+            if(score <= maxScore)
+                return j + 1;
+            continue;
+        }
+
+        // Each remaining column can decrease the score by one at most.
+        auto remaining = text.size() - j - 1;
+        if(score > maxScore + remaining)
+            return maxScore + 1;
+    }
+
+    if(mode == Mode::Search)
+        return std::string_view::npos;
+
+    return std::min(score, maxScore + 1);
+}
+
+//------------------------------------------------------------------------------
+// Gives the buffers to Run - from the stack when the pattern fits a word.
+size_t RunWithBuffers(
+    std::string_view pattern,
+    std::string_view text,
+    size_t           maxScore,
+    Mode             mode)
+{
+    auto blocks_count = (pattern.size() + kWordBits - 1) / kWordBits;
+    if(blocks_count <= 1)
+    {
+        uint64_t peq[256];
+        Block    block;
+        return Run(pattern, text, maxScore, mode, peq, &block);
+    }
+
+    auto peq    = std::vector<uint64_t>(256 * blocks_count);
+    auto blocks = std::vector<Block>(blocks_count);
+    return Run(pattern, text, maxScore, mode, peq.data(), blocks.data());
+}
+
+//------------------------------------------------------------------------------
+size_t Distance(
+    std::string_view lhs,
+    std::string_view rhs,
+    size_t           maxDistance,
+    Mode             mode)
+{
+    // The shortest string goes to the bit vectors.
+    if(lhs.size() > rhs.size())
+        std::swap(lhs, rhs);
+
+    // Can't be closer than the difference of the sizes.
+    if(maxDistance != std::string::npos && rhs.size() - lhs.size() > maxDistance)
+        return maxDistance + 1;
+
+    if(lhs.empty())
+        return rhs.size();
+
+    // npos + 1 would wrap, keep it as the largest.
+    auto max_score = std::min(maxDistance, rhs.size());
+    auto distance  = RunWithBuffers(lhs, rhs, max_score, mode);
+
+    return (distance > max_score) ? maxDistance + 1 : distance;
+}
+
+} // Anonymous namespace.
+
+
+//------------------------------------------------------------------------------
+size_t CoreString::EditDistance(
+    std::string_view lhs,
+    std::string_view rhs,
+    size_t           maxDistance /* = std::string::npos */)
+{
+    return Distance(lhs, rhs, maxDistance, Mode::Levenshtein);
+}
+
+//------------------------------------------------------------------------------
+size_t CoreString::DamerauDistance(
+    std::string_view lhs,
+    std::string_view rhs,
+    size_t           maxDistance /* = std::string::npos */)
+{
+    return Distance(lhs, rhs, maxDistance, Mode::Damerau);
+}
+
+
+//------------------------------------------------------------------------------
+size_t CoreString::FuzzyFind(
+    std::string_view haystack,
+    std::string_view needle,
+    size_t           maxErrors)
+{
+    // Deleting the whole needle is enough.
+    if(needle.size() <= maxErrors)
+        return 0;
+
+    return RunWithBuffers(needle, haystack, maxErrors, Mode::Search);
+}
+
+//------------------------------------------------------------------------------
+bool CoreString::FuzzyContains(
+    std::string_view haystack,
+    std::string_view needle,
+    size_t           maxErrors)
+{
+    return FuzzyFind(haystack, needle, maxErrors) != std::string::npos;
+}
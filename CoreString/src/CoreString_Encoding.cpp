@@ -0,0 +1,771 @@
+// Header
+#include "../include/CoreString_Encoding.h"
+// std
+#include <array>
+#include <cstdint>
+// CoreString
+#include "CoreString_Simd.h"
+
+using namespace CoreString::Private_Simd;
+using CoreString::Base64Variant;
+
+
+//------------------------------------------------------------------------------
+// Helper Functions.
+namespace {
+
+//------------------------------------------------------------------------------
+// Tables.
+constexpr char kBase64Standard[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+constexpr char kBase64Url[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+constexpr char kHexLower[] = "0123456789abcdef";
+constexpr char kHexUpper[] = "0123456789ABCDEF";
+
+// Value of each char, -1 for the ones that aren't in the alphabet.
+typedef std::array<int8_t, 256> ValuesTable;
+
+constexpr ValuesTable MakeBase64Values(const char *alphabet) noexcept
+{
+    auto table = ValuesTable{};
+    for(auto &value : table)
+        value = -1;
+    for(auto i = 0; i < 64; ++i)
+        table[uint8_t(alphabet[i])] = int8_t(i);
+
+    return table;
+}
+
+constexpr ValuesTable MakeHexValues() noexcept
+{
+    auto table = ValuesTable{};
+    for(auto &value : table)
+        value = -1;
+    for(auto i = 0; i < 16; ++i)
+    {
+        table[uint8_t(kHexLower[i])] = int8_t(i);
+        table[uint8_t(kHexUpper[i])] = int8_t(i);
+    }
+
+    return table;
+}
+
+constexpr ValuesTable kBase64StandardValues = MakeBase64Values(kBase64Standard);
+constexpr ValuesTable kBase64UrlValues      = MakeBase64Values(kBase64Url);
+constexpr ValuesTable kHexValues            = MakeHexValues();
+
+inline const char* Base64Alphabet(Base64Variant variant) noexcept
+{
+    return (variant == Base64Variant::Url) ? kBase64Url : kBase64Standard;
+}
+
+inline const ValuesTable& Base64Values(Base64Variant variant) noexcept
+{
+    return (variant == Base64Variant::Url)
+        ? kBase64UrlValues
+        : kBase64StandardValues;
+}
+
+// Grows out by size chars and returns where they start.
+inline char* Extend(std::string &out, size_t size)
+{
+    auto old_size = out.size();
+    out.resize(old_size + size);
+    return &out[0] + old_size;
+}
+
+
+//------------------------------------------------------------------------------
+// Base64 Encode.
+//   The kernels turn 12 bytes into 16 chars (24 into 32 with AVX2), as
+//   described by W. Muła and D. Lemire in "Faster Base64 Encoding and
+//   Decoding Using AVX2 Instructions": the bytes are shuffled so each
+//   32 bit lane has the 3 bytes of a group, the 4 sextets are moved to
+//   their own bytes with two multiplies and then each is turned into
+//   its char by adding an offset picked with a shuffle.
+#if CORESTRING_HAS_SSSE3
+inline __m128i Base64Sextets16(__m128i in) noexcept
+{
+    in = _mm_shuffle_epi8(
+        in,
+        _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1)
+    );
+
+    auto t0 = _mm_and_si128   (in, _mm_set1_epi32(0x0FC0FC00));
+    auto t1 = _mm_mulhi_epu16 (t0, _mm_set1_epi32(0x04000040));
+    auto t2 = _mm_and_si128   (in, _mm_set1_epi32(0x003F03F0));
+    auto t3 = _mm_mullo_epi16 (t2, _mm_set1_epi32(0x01000010));
+
+    return _mm_or_si128(t1, t3);
+}
+
+// The offsets are indexed by: 0 for 26...51, 1...10 for the digits,
+// 11 and 12 for the values 62 and 63 and 13 for the uppercase letters.
+inline __m128i Base64OffsetsLut(const char *alphabet) noexcept
+{
+    return _mm_setr_epi8(
+        'a' - 26,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        char(alphabet[62] - 62),
+        char(alphabet[63] - 63),
+        'A', 0, 0
+    );
+}
+
+inline __m128i Base64Chars16(__m128i sextets, __m128i lut) noexcept
+{
+    auto index = _mm_subs_epu8(sextets, _mm_set1_epi8(51));
+    auto upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), sextets);
+    index      = _mm_or_si128(index, _mm_and_si128(upper, _mm_set1_epi8(13)));
+
+    return _mm_add_epi8(sextets, _mm_shuffle_epi8(lut, index));
+}
+#endif // CORESTRING_HAS_SSSE3
+
+#if CORESTRING_HAS_AVX2
+inline __m256i Base64Sextets32(__m256i in) noexcept
+{
+    in = _mm256_shuffle_epi8(
+        in,
+        _mm256_set_epi8(
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1
+        )
+    );
+
+    auto t0 = _mm256_and_si256   (in, _mm256_set1_epi32(0x0FC0FC00));
+    auto t1 = _mm256_mulhi_epu16 (t0, _mm256_set1_epi32(0x04000040));
+    auto t2 = _mm256_and_si256   (in, _mm256_set1_epi32(0x003F03F0));
+    auto t3 = _mm256_mullo_epi16 (t2, _mm256_set1_epi32(0x01000010));
+
+    return _mm256_or_si256(t1, t3);
+}
+
+inline __m256i Base64Chars32(__m256i sextets, __m256i lut) noexcept
+{
+    auto index = _mm256_subs_epu8(sextets, _mm256_set1_epi8(51));
+    auto upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), sextets);
+    index      = _mm256_or_si256(index, _mm256_and_si256(upper, _mm256_set1_epi8(13)));
+
+    return _mm256_add_epi8(sextets, _mm256_shuffle_epi8(lut, index));
+}
+#endif // CORESTRING_HAS_AVX2
+
+// Encodes size bytes (any amount) into exactly
+// Base64EncodedSize(size, padding) chars.
+void Base64Encode(
+    const uint8_t *in,
+    size_t         size,
+    char          *out,
+    const char    *alphabet,
+    bool           padding) noexcept
+{
+    auto end = in + size;
+
+#if CORESTRING_HAS_SSSE3
+    auto lut = Base64OffsetsLut(alphabet);
+
+    #if CORESTRING_HAS_AVX2
+    // Each lane reads 16 bytes but uses 12.
+    auto lut32 = _mm256_broadcastsi128_si256(lut);
+    while(end - in >= 28)
+    {
+        auto lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+        auto hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 12));
+        auto v  = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i *>(out),
+            Base64Chars32(Base64Sextets32(v), lut32)
+        );
+        in  += 24;
+        out += 32;
+    }
+    #endif // CORESTRING_HAS_AVX2
+
+    while(end - in >= 16)
+    {
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i *>(out),
+            Base64Chars16(Base64Sextets16(v), lut)
+        );
+        in  += 12;
+        out += 16;
+    }
+#endif // CORESTRING_HAS_SSSE3
+
+    while(end - in >= 3)
+    {
+        uint32_t group = (uint32_t(in[0]) << 16) | (uint32_t(in[1]) << 8) | in[2];
+        out[0] = alphabet[(group >> 18) & 0x3F];
+        out[1] = alphabet[(group >> 12) & 0x3F];
+        out[2] = alphabet[(group >>  6) & 0x3F];
+        out[3] = alphabet[(group      ) & 0x3F];
+        in  += 3;
+        out += 4;
+    }
+
+    auto remaining = size_t(end - in);
+    if(remaining == 0)
+        return;
+
+    uint32_t group = uint32_t(in[0]) << 16;
+    if(remaining == 2)
+        group |= uint32_t(in[1]) << 8;
+
+    *out++ = alphabet[(group >> 18) & 0x3F];
+    *out++ = alphabet[(group >> 12) & 0x3F];
+    if(remaining == 2)
+        *out++ = alphabet[(group >> 6) & 0x3F];
+    else if(padding)
+        *out++ = '=';
+
+    if(padding)
+        *out++ = '=';
+}
+
+
+//------------------------------------------------------------------------------
+// Base64 Decode.
+//   The chars are validated and translated to their values by ranges,
+//   then the sextets are packed back to bytes: with SSSE3 by two
+//   multiply-adds and a shuffle, otherwise one group at time.
+#if CORESTRING_HAS_SSE2
+// The values of the 16 chars - returns false if any isn't in the alphabet.
+inline bool Base64Values16(__m128i v, const char *alphabet, __m128i &values) noexcept
+{
+    auto upper = InRange16(v, 'A', 'Z');
+    auto lower = InRange16(v, 'a', 'z');
+    auto digit = InRange16(v, '0', '9');
+    auto c62   = Equal16(v, alphabet[62]);
+    auto c63   = Equal16(v, alphabet[63]);
+
+    auto valid = _mm_or_si128(
+        _mm_or_si128(upper, lower),
+        _mm_or_si128(digit, _mm_or_si128(c62, c63))
+    );
+    if(Mask16(valid) != 0xFFFF)
+        return false;
+
+    auto shift = _mm_or_si128(
+        _mm_or_si128(
+            _mm_and_si128(upper, _mm_set1_epi8(-'A')),
+            _mm_and_si128(lower, _mm_set1_epi8(26 - 'a'))
+        ),
+        _mm_or_si128(
+            _mm_and_si128(digit, _mm_set1_epi8(52 - '0')),
+            _mm_or_si128(
+                _mm_and_si128(c62, _mm_set1_epi8(char(62 - alphabet[62]))),
+                _mm_and_si128(c63, _mm_set1_epi8(char(63 - alphabet[63])))
+            )
+        )
+    );
+
+    values = _mm_add_epi8(v, shift);
+    return true;
+}
+#endif // CORESTRING_HAS_SSE2
+
+#if CORESTRING_HAS_SSSE3
+// Packs the 16 sextets into the low 12 bytes.
+inline __m128i Base64Pack16(__m128i values) noexcept
+{
+    auto merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    merged      = _mm_madd_epi16   (merged, _mm_set1_epi32(0x00011000));
+
+    return _mm_shuffle_epi8(
+        merged,
+        _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)
+    );
+}
+#endif // CORESTRING_HAS_SSSE3
+
+#if CORESTRING_HAS_AVX2
+inline __m256i InRange32(__m256i v, char lo, char hi) noexcept
+{
+    auto shifted = _mm256_add_epi8(v, _mm256_set1_epi8(char(0x80 - uint8_t(lo))));
+    return _mm256_cmpgt_epi8(_mm256_set1_epi8(char(-128 + (hi - lo) + 1)), shifted);
+}
+
+inline __m256i Equal32(__m256i v, char c) noexcept
+{
+    return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(c));
+}
+
+inline bool Base64Values32(__m256i v, const char *alphabet, __m256i &values) noexcept
+{
+    auto upper = InRange32(v, 'A', 'Z');
+    auto lower = InRange32(v, 'a', 'z');
+    auto digit = InRange32(v, '0', '9');
+    auto c62   = Equal32(v, alphabet[62]);
+    auto c63   = Equal32(v, alphabet[63]);
+
+    auto valid = _mm256_or_si256(
+        _mm256_or_si256(upper, lower),
+        _mm256_or_si256(digit, _mm256_or_si256(c62, c63))
+    );
+    if(unsigned(_mm256_movemask_epi8(valid)) != 0xFFFFFFFFu)
+        return false;
+
+    auto shift = _mm256_or_si256(
+        _mm256_or_si256(
+            _mm256_and_si256(upper, _mm256_set1_epi8(-'A')),
+            _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a'))
+        ),
+        _mm256_or_si256(
+            _mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')),
+            _mm256_or_si256(
+                _mm256_and_si256(c62, _mm256_set1_epi8(char(62 - alphabet[62]))),
+                _mm256_and_si256(c63, _mm256_set1_epi8(char(63 - alphabet[63])))
+            )
+        )
+    );
+
+    values = _mm256_add_epi8(v, shift);
+    return true;
+}
+
+// Packs the 32 sextets into the low 24 bytes.
+inline __m256i Base64Pack32(__m256i values) noexcept
+{
+    auto merged = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    merged      = _mm256_madd_epi16   (merged, _mm256_set1_epi32(0x00011000));
+    merged      = _mm256_shuffle_epi8(
+        merged,
+        _mm256_setr_epi8(
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+        )
+    );
+
+    return _mm256_permutevar8x32_epi32(merged, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+}
+#endif // CORESTRING_HAS_AVX2
+
+// Decodes size chars (without the padding) into out, that must have
+// room for all the bytes. Returns false if any char isn't valid or if
+// the unused bits of the last char aren't zero.
+bool Base64Decode(
+    const uint8_t     *in,
+    size_t             size,
+    uint8_t           *out,
+    const char        *alphabet,
+    const ValuesTable &table) noexcept
+{
+    auto end = in + size;
+#if !CORESTRING_HAS_SSE2
+    (void)alphabet; // The scalar loops use the table.
+#endif
+
+    // The stores are wider than what is decoded, so the loops leave
+    // enough chars for those extra bytes to still be inside out.
+#if CORESTRING_HAS_AVX2
+    while(end - in >= 48)
+    {
+        auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in));
+        auto values = __m256i{};
+        if(!Base64Values32(v, alphabet, values))
+            return false;
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), Base64Pack32(values));
+        in  += 32;
+        out += 24;
+    }
+#endif // CORESTRING_HAS_AVX2
+
+#if CORESTRING_HAS_SSE2
+    while(end - in >= 24)
+    {
+        auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+        auto values = __m128i{};
+        if(!Base64Values16(v, alphabet, values))
+            return false;
+
+    #if CORESTRING_HAS_SSSE3
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), Base64Pack16(values));
+    #else
+        alignas(16) uint8_t sextets[16];
+        _mm_store_si128(reinterpret_cast<__m128i *>(sextets), values);
+        for(auto i = 0; i < 4; ++i)
+        {
+            auto s = sextets + i * 4;
+            uint32_t group = (uint32_t(s[0]) << 18) | (uint32_t(s[1]) << 12)
+                           | (uint32_t(s[2]) <<  6) |  uint32_t(s[3]);
+            out[i * 3 + 0] = uint8_t(group >> 16);
+            out[i * 3 + 1] = uint8_t(group >>  8);
+            out[i * 3 + 2] = uint8_t(group);
+        }
+    #endif // CORESTRING_HAS_SSSE3
+        in  += 16;
+        out += 12;
+    }
+#endif // CORESTRING_HAS_SSE2
+
+    // Or-ing the values makes any -1 show up in the sign bit.
+    while(end - in >= 4)
+    {
+        int32_t a = table[in[0]];
+        int32_t b = table[in[1]];
+        int32_t c = table[in[2]];
+        int32_t d = table[in[3]];
+        if((a | b | c | d) < 0)
+            return false;
+
+        uint32_t group = (uint32_t(a) << 18) | (uint32_t(b) << 12)
+                       | (uint32_t(c) <<  6) |  uint32_t(d);
+        out[0] = uint8_t(group >> 16);
+        out[1] = uint8_t(group >>  8);
+        out[2] = uint8_t(group);
+        in  += 4;
+        out += 3;
+    }
+
+    auto remaining = size_t(end - in);
+    if(remaining == 0)
+        return true;
+
+    int32_t a = table[in[0]];
+    int32_t b = table[in[1]];
+    int32_t c = (remaining == 3) ? table[in[2]] : 0;
+    if((a | b | c) < 0)
+        return false;
+
+    uint32_t group = (uint32_t(a) << 18) | (uint32_t(b) << 12) | (uint32_t(c) << 6);
+    out[0] = uint8_t(group >> 16);
+    if(remaining == 3)
+        out[1] = uint8_t(group >> 8);
+
+    // The bits that don't make a whole byte must be zero.
+    auto unused_mask = (remaining == 3) ? 0xFFu : 0xFFFFu;
+    return (group & unused_mask) == 0;
+}
+
+
+//------------------------------------------------------------------------------
+// Hex.
+#if CORESTRING_HAS_SSE2
+// The digits of the 16 nibbles.
+inline __m128i HexDigits16(__m128i nibbles, char letterOffset) noexcept
+{
+    auto is_letter = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+    auto offset    = _mm_and_si128(is_letter, _mm_set1_epi8(letterOffset));
+
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), offset);
+}
+
+// The nibbles of the 16 digits, each 16 bit lane packed to a byte (in
+// its low half) - returns false if any isn't a hex digit.
+inline bool HexPairs16(__m128i v, __m128i &pairs) noexcept
+{
+    auto folded = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    auto digit  = InRange16(v,      '0', '9');
+    auto letter = InRange16(folded, 'a', 'f');
+    if(Mask16(_mm_or_si128(digit, letter)) != 0xFFFF)
+        return false;
+
+    auto nibbles = _mm_or_si128(
+        _mm_and_si128(digit,  _mm_sub_epi8(v,      _mm_set1_epi8('0'))),
+        _mm_and_si128(letter, _mm_sub_epi8(folded, _mm_set1_epi8('a' - 10)))
+    );
+
+    auto high = _mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0xFF)), 4);
+    pairs     = _mm_or_si128(high, _mm_srli_epi16(nibbles, 8));
+    return true;
+}
+#endif // CORESTRING_HAS_SSE2
+
+#if CORESTRING_HAS_AVX2
+inline __m256i HexDigits32(__m256i nibbles, char letterOffset) noexcept
+{
+    auto is_letter = _mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9));
+    auto offset    = _mm256_and_si256(is_letter, _mm256_set1_epi8(letterOffset));
+
+    return _mm256_add_epi8(_mm256_add_epi8(nibbles, _mm256_set1_epi8('0')), offset);
+}
+
+inline bool HexPairs32(__m256i v, __m256i &pairs) noexcept
+{
+    auto folded = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+    auto digit  = InRange32(v,      '0', '9');
+    auto letter = InRange32(folded, 'a', 'f');
+    if(unsigned(_mm256_movemask_epi8(_mm256_or_si256(digit, letter))) != 0xFFFFFFFFu)
+        return false;
+
+    auto nibbles = _mm256_or_si256(
+        _mm256_and_si256(digit,  _mm256_sub_epi8(v,      _mm256_set1_epi8('0'))),
+        _mm256_and_si256(letter, _mm256_sub_epi8(folded, _mm256_set1_epi8('a' - 10)))
+    );
+
+    auto high = _mm256_slli_epi16(_mm256_and_si256(nibbles, _mm256_set1_epi16(0xFF)), 4);
+    pairs     = _mm256_or_si256(high, _mm256_srli_epi16(nibbles, 8));
+    return true;
+}
+#endif // CORESTRING_HAS_AVX2
+
+void HexEncode(const uint8_t *in, size_t size, char *out, bool uppercase) noexcept
+{
+    auto end    = in + size;
+    auto digits = (uppercase) ? kHexUpper : kHexLower;
+
+#if CORESTRING_HAS_SSE2
+    // What goes from '9' + 1 to the first letter.
+    auto letter_offset = char(((uppercase) ? 'A' : 'a') - '0' - 10);
+
+    #if CORESTRING_HAS_AVX2
+    while(end - in >= 32)
+    {
+        auto v  = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in));
+        auto hi = HexDigits32(
+            _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F)),
+            letter_offset
+        );
+        auto lo = HexDigits32(_mm256_and_si256(v, _mm256_set1_epi8(0x0F)), letter_offset);
+
+        // The unpacks work inside each lane, so the halves are swapped back.
+        auto first  = _mm256_unpacklo_epi8(hi, lo);
+        auto second = _mm256_unpackhi_epi8(hi, lo);
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i *>(out),
+            _mm256_permute2x128_si256(first, second, 0x20)
+        );
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i *>(out + 32),
+            _mm256_permute2x128_si256(first, second, 0x31)
+        );
+        in  += 32;
+        out += 64;
+    }
+    #endif // CORESTRING_HAS_AVX2
+
+    while(end - in >= 16)
+    {
+        auto v  = Load16(reinterpret_cast<const char *>(in));
+        auto hi = HexDigits16(
+            _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0F)),
+            letter_offset
+        );
+        auto lo = HexDigits16(_mm_and_si128(v, _mm_set1_epi8(0x0F)), letter_offset);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),      _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 16), _mm_unpackhi_epi8(hi, lo));
+        in  += 16;
+        out += 32;
+    }
+#endif // CORESTRING_HAS_SSE2
+
+    for(; in != end; ++in)
+    {
+        *out++ = digits[*in >> 4];
+        *out++ = digits[*in & 0x0F];
+    }
+}
+
+// Decodes size (even) digits into out - false if any isn't a digit.
+bool HexDecode(const uint8_t *in, size_t size, uint8_t *out) noexcept
+{
+    auto end = in + size;
+
+#if CORESTRING_HAS_AVX2
+    while(end - in >= 64)
+    {
+        auto a = __m256i{};
+        auto b = __m256i{};
+        if(!HexPairs32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(in)),      a) ||
+           !HexPairs32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + 32)), b))
+        {
+            return false;
+        }
+
+        // The pack works inside each lane, so the quarters are reordered.
+        auto bytes = _mm256_permute4x64_epi64(
+            _mm256_packus_epi16(a, b),
+            _MM_SHUFFLE(3, 1, 2, 0)
+        );
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), bytes);
+        in  += 64;
+        out += 32;
+    }
+#endif // CORESTRING_HAS_AVX2
+
+#if CORESTRING_HAS_SSE2
+    while(end - in >= 32)
+    {
+        auto a = __m128i{};
+        auto b = __m128i{};
+        if(!HexPairs16(Load16(reinterpret_cast<const char *>(in)),      a) ||
+           !HexPairs16(Load16(reinterpret_cast<const char *>(in + 16)), b))
+        {
+            return false;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_packus_epi16(a, b));
+        in  += 32;
+        out += 16;
+    }
+#endif // CORESTRING_HAS_SSE2
+
+    for(; in != end; in += 2)
+    {
+        int32_t hi = kHexValues[in[0]];
+        int32_t lo = kHexValues[in[1]];
+        if((hi | lo) < 0)
+            return false;
+
+        *out++ = uint8_t((hi << 4) | lo);
+    }
+
+    return true;
+}
+
+} // Anonymous namespace.
+
+
+//------------------------------------------------------------------------------
+std::string CoreString::EncodeBase64(
+    std::string_view data,
+    Base64Variant    variant /* = Base64Variant::Standard */,
+    bool             padding /* = true */)
+{
+    auto result = std::string();
+    EncodeBase64To(result, data, variant, padding);
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+void CoreString::EncodeBase64To(
+    std::string      &out,
+    std::string_view  data,
+    Base64Variant     variant /* = Base64Variant::Standard */,
+    bool              padding /* = true */)
+{
+    if(data.empty())
+        return;
+
+    auto dst = Extend(out, Base64EncodedSize(data.size(), padding));
+    Base64Encode(
+        reinterpret_cast<const uint8_t *>(data.data()),
+        data.size(),
+        dst,
+        Base64Alphabet(variant),
+        padding
+    );
+}
+
+//------------------------------------------------------------------------------
+bool CoreString::DecodeBase64To(
+    std::string      &out,
+    std::string_view  str,
+    Base64Variant     variant /* = Base64Variant::Standard */)
+{
+    // Padding is optional, but when present it must complete the
+    // last group - so the size must be a multiple of 4.
+    auto size = str.size();
+    if(size != 0 && str[size - 1] == '=')
+    {
+        if(size % 4 != 0)
+            return false;
+
+        --size;
+        if(str[size - 1] == '=')
+            --size;
+    }
+
+    auto remaining = size % 4;
+    if(remaining == 1)
+        return false;
+    if(size == 0)
+        return true;
+
+    auto old_size     = out.size();
+    auto decoded_size = size / 4 * 3 + ((remaining == 0) ? 0 : remaining - 1);
+    auto dst          = Extend(out, decoded_size);
+
+    auto ok = Base64Decode(
+        reinterpret_cast<const uint8_t *>(str.data()),
+        size,
+        reinterpret_cast<uint8_t *>(dst),
+        Base64Alphabet(variant),
+        Base64Values  (variant)
+    );
+    if(!ok)
+        out.resize(old_size);
+
+    return ok;
+}
+
+//------------------------------------------------------------------------------
+std::string CoreString::DecodeBase64(
+    std::string_view str,
+    Base64Variant    variant /* = Base64Variant::Standard */)
+{
+    auto result = std::string();
+    DecodeBase64To(result, str, variant);
+
+    return result;
+}
+
+
+//------------------------------------------------------------------------------
+std::string CoreString::EncodeHex(
+    std::string_view data,
+    bool             uppercase /* = false */)
+{
+    auto result = std::string();
+    EncodeHexTo(result, data, uppercase);
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+void CoreString::EncodeHexTo(
+    std::string      &out,
+    std::string_view  data,
+    bool              uppercase /* = false */)
+{
+    if(data.empty())
+        return;
+
+    auto dst = Extend(out, data.size() * 2);
+    HexEncode(
+        reinterpret_cast<const uint8_t *>(data.data()),
+        data.size(),
+        dst,
+        uppercase
+    );
+}
+
+//------------------------------------------------------------------------------
+bool CoreString::DecodeHexTo(std::string &out, std::string_view str)
+{
+    if(str.size() % 2 != 0)
+        return false;
+    if(str.empty())
+        return true;
+
+    auto old_size = out.size();
+    auto dst      = Extend(out, str.size() / 2);
+
+    auto ok = HexDecode(
+        reinterpret_cast<const uint8_t *>(str.data()),
+        str.size(),
+        reinterpret_cast<uint8_t *>(dst)
+    );
+    if(!ok)
+        out.resize(old_size);
+
+    return ok;
+}
+
+//------------------------------------------------------------------------------
+std::string CoreString::DecodeHex(std::string_view str)
+{
+    auto result = std::string();
+    DecodeHexTo(result, str);
+
+    return result;
+}
@@ -0,0 +1,578 @@
+// Header
+#include "../include/CoreString_Escape.h"
+// std
+#include <array>
+#include <cstdint>
+// CoreString
+#include "CoreString_Simd.h"
+
+using namespace CoreString::Private_Simd;
+using CoreString::EscapeFormat;
+
+
+//------------------------------------------------------------------------------
+// Helper Functions.
+namespace {
+
+constexpr char kHexDigits[] = "0123456789ABCDEF";
+
+//------------------------------------------------------------------------------
+// How many chars each byte takes once escaped - 1 for the ones kept as is.
+constexpr bool IsUrlUnreserved(uint8_t c) noexcept
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           (c >= '0' && c <= '9') ||
+           c == '-' || c == '_' || c == '.' || c == '~';
+}
+
+constexpr uint8_t EscapedLength(EscapeFormat format, uint8_t c) noexcept
+{
+    switch(format)
+    {
+        case EscapeFormat::Json:
+            if(c == '"' || c == '\\')                  return 2;
+            if(c == '\b' || c == '\f' || c == '\n' ||
+               c == '\r' || c == '\t')                 return 2;
+            if(c < 0x20)                               return 6; // \u00XX
+            return 1;
+
+        case EscapeFormat::Html:
+            if(c == '&')  return 5; // &amp;
+            if(c == '<')  return 4; // &lt;
+            if(c == '>')  return 4; // &gt;
+            if(c == '"')  return 6; // &quot;
+            if(c == '\'') return 5; // &#39;
+            return 1;
+
+        case EscapeFormat::Url:
+            return IsUrlUnreserved(c) ? 1 : 3; // %XX
+
+        case EscapeFormat::C:
+            if(c == '\\' || c == '"' || c == '\'')     return 2;
+            if(c == '\a' || c == '\b' || c == '\f' ||
+               c == '\n' || c == '\r' || c == '\t' ||
+               c == '\v')                              return 2;
+            if(c < 0x20 || c >= 0x7F)                  return 4; // \ooo
+            return 1;
+    }
+    return 1;
+}
+
+typedef std::array<uint8_t, 256> LengthsTable;
+
+constexpr LengthsTable MakeLengthsTable(EscapeFormat format) noexcept
+{
+    auto table = LengthsTable{};
+    for(auto c = 0; c < 256; ++c)
+        table[c] = EscapedLength(format, uint8_t(c));
+
+    return table;
+}
+
+template <EscapeFormat Format>
+constexpr LengthsTable kLengths = MakeLengthsTable(Format);
+
+
+//------------------------------------------------------------------------------
+// Bit i set if the byte i needs escaping.
+#if CORESTRING_HAS_SSE2
+template <EscapeFormat Format>
+inline unsigned EscapeMask16(__m128i v) noexcept
+{
+    if constexpr(Format == EscapeFormat::Json)
+    {
+        auto control = InRange16(v, 0x00, 0x1F);
+        auto special = _mm_or_si128(Equal16(v, '"'), Equal16(v, '\\'));
+        return Mask16(_mm_or_si128(control, special));
+    }
+    else if constexpr(Format == EscapeFormat::Html)
+    {
+        auto m = _mm_or_si128(Equal16(v, '&'), Equal16(v, '<'));
+        m = _mm_or_si128(m, Equal16(v, '>'));
+        m = _mm_or_si128(m, Equal16(v, '"'));
+        m = _mm_or_si128(m, Equal16(v, '\''));
+        return Mask16(m);
+    }
+    else if constexpr(Format == EscapeFormat::Url)
+    {
+        auto safe = _mm_or_si128(InRange16(FoldAscii16(v), 'a', 'z'), InRange16(v, '0', '9'));
+        safe = _mm_or_si128(safe, Equal16(v, '-'));
+        safe = _mm_or_si128(safe, Equal16(v, '_'));
+        safe = _mm_or_si128(safe, Equal16(v, '.'));
+        safe = _mm_or_si128(safe, Equal16(v, '~'));
+        return ~Mask16(safe) & 0xFFFF;
+    }
+    else
+    {
+        // Everything out of [0x20, 0x7E] plus the quotes and backslash.
+        auto printable = InRange16(v, 0x20, 0x7E);
+        auto special   = _mm_or_si128(Equal16(v, '"'), Equal16(v, '\\'));
+        special = _mm_or_si128(special, Equal16(v, '\''));
+        return (~Mask16(printable) & 0xFFFF) | Mask16(special);
+    }
+}
+#endif // CORESTRING_HAS_SSE2
+
+//------------------------------------------------------------------------------
+// Index of the first byte from index on that needs escaping, or size.
+template <EscapeFormat Format>
+size_t FindEscapable(const char *data, size_t size, size_t index) noexcept
+{
+#if CORESTRING_HAS_SSE2
+    for(; index + 16 <= size; index += 16)
+    {
+        auto mask = EscapeMask16<Format>(Load16(data + index));
+        if(mask != 0)
+            return index + FirstSetBit(mask);
+    }
+#endif
+
+    const auto &lengths = kLengths<Format>;
+    for(; index < size; ++index)
+    {
+        if(lengths[uint8_t(data[index])] != 1)
+            return index;
+    }
+
+    return size;
+}
+
+//------------------------------------------------------------------------------
+template <EscapeFormat Format>
+size_t EscapedSizeImpl(std::string_view str) noexcept
+{
+    const auto &lengths = kLengths<Format>;
+
+    auto size  = str.size();
+    auto index = FindEscapable<Format>(str.data(), str.size(), 0);
+    while(index < str.size())
+    {
+        size += lengths[uint8_t(str[index])] - 1;
+        index = FindEscapable<Format>(str.data(), str.size(), index + 1);
+    }
+
+    return size;
+}
+
+//------------------------------------------------------------------------------
+// Writes the escaped c at out, returning past the written chars.
+template <EscapeFormat Format>
+char* WriteEscaped(char *out, uint8_t c) noexcept
+{
+    auto write = [&out](std::string_view text) {
+        for(auto t : text)
+            *out++ = t;
+    };
+
+    if constexpr(Format == EscapeFormat::Json)
+    {
+        switch(c)
+        {
+            case '"' : write("\\\""); return out;
+            case '\\': write("\\\\"); return out;
+            case '\b': write("\\b");  return out;
+            case '\f': write("\\f");  return out;
+            case '\n': write("\\n");  return out;
+            case '\r': write("\\r");  return out;
+            case '\t': write("\\t");  return out;
+        }
+
+        write("\\u00");
+        *out++ = kHexDigits[c >> 4];
+        *out++ = kHexDigits[c & 0xF];
+    }
+    else if constexpr(Format == EscapeFormat::Html)
+    {
+        switch(c)
+        {
+            case '&' : write("&amp;");  break;
+            case '<' : write("&lt;");   break;
+            case '>' : write("&gt;");   break;
+            case '"' : write("&quot;"); break;
+            case '\'': write("&#39;");  break;
+        }
+    }
+    else if constexpr(Format == EscapeFormat::Url)
+    {
+        *out++ = '%';
+        *out++ = kHexDigits[c >> 4];
+        *out++ = kHexDigits[c & 0xF];
+    }
+    else
+    {
+        switch(c)
+        {
+            case '\\': write("\\\\"); return out;
+            case '"' : write("\\\""); return out;
+            case '\'': write("\\'");  return out;
+            case '\a': write("\\a");  return out;
+            case '\b': write("\\b");  return out;
+            case '\f': write("\\f");  return out;
+            case '\n': write("\\n");  return out;
+            case '\r': write("\\r");  return out;
+            case '\t': write("\\t");  return out;
+            case '\v': write("\\v");  return out;
+        }
+
+        // Octal has at most 3 digits, so unlike \x it never
+        // takes the chars that come after it.
+        *out++ = '\\';
+        *out++ = char('0' + (c >> 6));
+        *out++ = char('0' + ((c >> 3) & 7));
+        *out++ = char('0' + (c & 7));
+    }
+
+    return out;
+}
+
+//------------------------------------------------------------------------------
+template <EscapeFormat Format>
+void EscapeImpl(std::string &out, std::string_view str)
+{
+    //--------------------------------------------------------------------------
+    // First pass: the size, so out grows only once.
+    auto begin = out.size();
+    out.resize(begin + EscapedSizeImpl<Format>(str));
+
+    //--------------------------------------------------------------------------
+    // Second pass: the safe runs are copied at once.
+    auto dst   = &out[begin];
+    auto index = size_t(0);
+    while(index < str.size())
+    {
+        auto found = FindEscapable<Format>(str.data(), str.size(), index);
+
+        std::memcpy(dst, str.data() + index, found - index);
+        dst += found - index;
+
+        if(found == str.size())
+            break;
+
+        dst   = WriteEscaped<Format>(dst, uint8_t(str[found]));
+        index = found + 1;
+    }
+}
+
+
+//------------------------------------------------------------------------------
+int HexValue(char c) noexcept
+{
+    if(c >= '0' && c <= '9') return c - '0';
+    if(c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if(c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Reads count hex digits at index. Returns false if any isn't one.
+bool ReadHex(std::string_view str, size_t index, size_t count, uint32_t &value) noexcept
+{
+    if(index + count > str.size())
+        return false;
+
+    value = 0;
+    for(auto i = index; i < index + count; ++i)
+    {
+        auto digit = HexValue(str[i]);
+        if(digit < 0)
+            return false;
+        value = (value << 4) | uint32_t(digit);
+    }
+
+    return true;
+}
+
+bool IsValidCodePoint(uint32_t cp) noexcept
+{
+    return cp <= 0x10FFFF && (cp < 0xD800 || cp > 0xDFFF);
+}
+
+void AppendUtf8(std::string &out, uint32_t cp)
+{
+    if(cp < 0x80)
+    {
+        out.push_back(char(cp));
+    }
+    else if(cp < 0x800)
+    {
+        out.push_back(char(0xC0 | (cp >> 6)));
+        out.push_back(char(0x80 | (cp & 0x3F)));
+    }
+    else if(cp < 0x10000)
+    {
+        out.push_back(char(0xE0 | (cp >> 12)));
+        out.push_back(char(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(char(0x80 | (cp & 0x3F)));
+    }
+    else
+    {
+        out.push_back(char(0xF0 | (cp >> 18)));
+        out.push_back(char(0x80 | ((cp >> 12) & 0x3F)));
+        out.push_back(char(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back(char(0x80 | (cp & 0x3F)));
+    }
+}
+
+//------------------------------------------------------------------------------
+// Each of these decodes the sequence at index (where the escape char is),
+// returning how many chars it takes or 0 if it's malformed.
+size_t UnescapeJsonAt(std::string &out, std::string_view str, size_t index)
+{
+    if(index + 1 >= str.size())
+        return 0;
+
+    switch(str[index + 1])
+    {
+        case '"' : out.push_back('"');  return 2;
+        case '\\': out.push_back('\\'); return 2;
+        case '/' : out.push_back('/');  return 2;
+        case 'b' : out.push_back('\b'); return 2;
+        case 'f' : out.push_back('\f'); return 2;
+        case 'n' : out.push_back('\n'); return 2;
+        case 'r' : out.push_back('\r'); return 2;
+        case 't' : out.push_back('\t'); return 2;
+        case 'u' : break;
+        default  : return 0;
+    }
+
+    auto cp = uint32_t(0);
+    if(!ReadHex(str, index + 2, 4, cp))
+        return 0;
+
+    // High surrogate followed by the low one.
+    auto low = uint32_t(0);
+    if(cp >= 0xD800 && cp <= 0xDBFF            &&
+       index + 12 <= str.size()                &&
+       str[index + 6] == '\\' && str[index + 7] == 'u' &&
+       ReadHex(str, index + 8, 4, low)         &&
+       low >= 0xDC00 && low <= 0xDFFF)
+    {
+        AppendUtf8(out, 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00));
+        return 12;
+    }
+
+    // Lone surrogates can't be UTF-8.
+    AppendUtf8(out, IsValidCodePoint(cp) ? cp : 0xFFFD);
+    return 6;
+}
+
+//------------------------------------------------------------------------------
+size_t UnescapeHtmlAt(std::string &out, std::string_view str, size_t index)
+{
+    // The longest known is "&#x10FFFF;".
+    auto end = str.substr(index, 11).find(';');
+    if(end == std::string_view::npos)
+        return 0;
+
+    auto name = str.substr(index + 1, end - 1);
+    if(name == "amp" ) { out.push_back('&');  return end + 1; }
+    if(name == "lt"  ) { out.push_back('<');  return end + 1; }
+    if(name == "gt"  ) { out.push_back('>');  return end + 1; }
+    if(name == "quot") { out.push_back('"');  return end + 1; }
+    if(name == "apos") { out.push_back('\''); return end + 1; }
+
+    if(name.size() < 2 || name[0] != '#')
+        return 0;
+
+    auto hex    = (name[1] == 'x' || name[1] == 'X');
+    auto digits = name.substr(hex ? 2 : 1);
+    if(digits.empty())
+        return 0;
+
+    auto cp = uint32_t(0);
+    for(auto c : digits)
+    {
+        auto digit = (hex) ? HexValue(c) : ((c >= '0' && c <= '9') ? c - '0' : -1);
+        if(digit < 0)
+            return 0;
+        cp = cp * (hex ? 16 : 10) + uint32_t(digit);
+    }
+
+    if(cp == 0 || !IsValidCodePoint(cp))
+        return 0;
+
+    AppendUtf8(out, cp);
+    return end + 1;
+}
+
+//------------------------------------------------------------------------------
+size_t UnescapeUrlAt(std::string &out, std::string_view str, size_t index)
+{
+    auto value = uint32_t(0);
+    if(!ReadHex(str, index + 1, 2, value))
+        return 0;
+
+    out.push_back(char(value));
+    return 3;
+}
+
+//------------------------------------------------------------------------------
+size_t UnescapeCAt(std::string &out, std::string_view str, size_t index)
+{
+    if(index + 1 >= str.size())
+        return 0;
+
+    auto c = str[index + 1];
+    switch(c)
+    {
+        case 'a' : out.push_back('\a'); return 2;
+        case 'b' : out.push_back('\b'); return 2;
+        case 'f' : out.push_back('\f'); return 2;
+        case 'n' : out.push_back('\n'); return 2;
+        case 'r' : out.push_back('\r'); return 2;
+        case 't' : out.push_back('\t'); return 2;
+        case 'v' : out.push_back('\v'); return 2;
+        case '\\':
+        case '\'':
+        case '"' :
+        case '?' : out.push_back(c);    return 2;
+    }
+
+    //--------------------------------------------------------------------------
+    // Octal - up to 3 digits.
+    if(c >= '0' && c <= '7')
+    {
+        auto value = uint32_t(0);
+        auto size  = size_t(1);
+        for(; size <= 3 && index + size < str.size(); ++size)
+        {
+            auto digit = str[index + size];
+            if(digit < '0' || digit > '7')
+                break;
+            value = value * 8 + uint32_t(digit - '0');
+        }
+
+        if(value > 0xFF)
+            return 0;
+
+        out.push_back(char(value));
+        return size;
+    }
+
+    //--------------------------------------------------------------------------
+    // Hex - one or two digits.
+    if(c == 'x')
+    {
+        auto value = uint32_t(0);
+        if(ReadHex(str, index + 2, 2, value))
+        {
+            out.push_back(char(value));
+            return 4;
+        }
+        if(ReadHex(str, index + 2, 1, value))
+        {
+            out.push_back(char(value));
+            return 3;
+        }
+        return 0;
+    }
+
+    //--------------------------------------------------------------------------
+    // Universal names.
+    if(c == 'u' || c == 'U')
+    {
+        auto digits = size_t((c == 'u') ? 4 : 8);
+        auto cp     = uint32_t(0);
+        if(!ReadHex(str, index + 2, digits, cp) || !IsValidCodePoint(cp))
+            return 0;
+
+        AppendUtf8(out, cp);
+        return 2 + digits;
+    }
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+template <typename Func>
+void UnescapeImpl(std::string &out, std::string_view str, char escape, Func unescapeAt)
+{
+    // Unescaping never grows the string.
+    out.reserve(out.size() + str.size());
+
+    auto index = size_t(0);
+    while(true)
+    {
+        // find is memchr, that is already vectorized.
+        auto found = str.find(escape, index);
+        if(found == std::string_view::npos)
+            break;
+
+        out.append(str, index, found - index);
+
+        auto size = unescapeAt(out, str, found);
+        if(size == 0)
+        {
+            out.push_back(escape); // Malformed, kept as is.
+            size = 1;
+        }
+
+        index = found + size;
+    }
+
+    out.append(str, index);
+}
+
+} // Anonymous namespace.
+
+
+//------------------------------------------------------------------------------
+std::string CoreString::Escape(std::string_view str, EscapeFormat format)
+{
+    auto escaped_str = std::string();
+    EscapeTo(escaped_str, str, format);
+
+    return escaped_str;
+}
+
+//------------------------------------------------------------------------------
+void CoreString::EscapeTo(
+    std::string      &out,
+    std::string_view  str,
+    EscapeFormat      format)
+{
+    switch(format)
+    {
+        case EscapeFormat::Json: EscapeImpl<EscapeFormat::Json>(out, str); break;
+        case EscapeFormat::Html: EscapeImpl<EscapeFormat::Html>(out, str); break;
+        case EscapeFormat::Url : EscapeImpl<EscapeFormat::Url >(out, str); break;
+        case EscapeFormat::C   : EscapeImpl<EscapeFormat::C   >(out, str); break;
+    }
+}
+
+//------------------------------------------------------------------------------
+size_t CoreString::EscapedSize(std::string_view str, EscapeFormat format) noexcept
+{
+    switch(format)
+    {
+        case EscapeFormat::Json: return EscapedSizeImpl<EscapeFormat::Json>(str);
+        case EscapeFormat::Html: return EscapedSizeImpl<EscapeFormat::Html>(str);
+        case EscapeFormat::Url : return EscapedSizeImpl<EscapeFormat::Url >(str);
+        case EscapeFormat::C   : return EscapedSizeImpl<EscapeFormat::C   >(str);
+    }
+    return str.size();
+}
+
+
+//------------------------------------------------------------------------------
+std::string CoreString::Unescape(std::string_view str, EscapeFormat format)
+{
+    auto unescaped_str = std::string();
+    UnescapeTo(unescaped_str, str, format);
+
+    return unescaped_str;
+}
+
+//------------------------------------------------------------------------------
+void CoreString::UnescapeTo(
+    std::string      &out,
+    std::string_view  str,
+    EscapeFormat      format)
+{
+    switch(format)
+    {
+        case EscapeFormat::Json: UnescapeImpl(out, str, '\\', UnescapeJsonAt); break;
+        case EscapeFormat::Html: UnescapeImpl(out, str, '&',  UnescapeHtmlAt); break;
+        case EscapeFormat::Url : UnescapeImpl(out, str, '%',  UnescapeUrlAt ); break;
+        case EscapeFormat::C   : UnescapeImpl(out, str, '\\', UnescapeCAt   ); break;
+    }
+}
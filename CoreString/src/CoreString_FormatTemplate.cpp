@@ -0,0 +1,219 @@
+// Header
+#include "../include/CoreString_FormatTemplate.h"
+// std
+#include <cctype>
+
+using namespace CoreString::Private_FormatTemplate;
+
+
+//------------------------------------------------------------------------------
+CoreString::FormatTemplate::FormatTemplate(std::string_view format) :
+    m_literalsSize(0),
+    m_slotsCount  (0),
+    m_valid       (true)
+{
+    auto index = size_t(0);
+    while(index < format.size())
+    {
+        auto brace = format.find_first_of("{}", index);
+        if(brace == std::string_view::npos)
+        {
+            AddLiteral(format.substr(index));
+            break;
+        }
+
+        AddLiteral(format.substr(index, brace - index));
+
+        //----------------------------------------------------------------------
+        // Escaped braces.
+        auto c = format[brace];
+        if(brace + 1 < format.size() && format[brace + 1] == c)
+        {
+            AddLiteral(format.substr(brace, 1));
+            index = brace + 2;
+            continue;
+        }
+
+        //----------------------------------------------------------------------
+        // Slot.
+        auto close = (c == '{') ? format.find('}', brace) : std::string_view::npos;
+        if(close != std::string_view::npos)
+        {
+            auto slot  = format.substr(brace + 1, close - brace - 1);
+            auto colon = slot.find(':');
+            auto field = slot.substr(0, colon);
+            auto spec  = (colon == std::string_view::npos)
+                ? std::string_view()
+                : slot.substr(colon + 1);
+
+            if(AddSlot(field, spec))
+            {
+                index = close + 1;
+                continue;
+            }
+        }
+
+        // Malformed - the rest is text.
+        m_valid = false;
+        AddLiteral(format.substr(brace));
+        break;
+    }
+}
+
+
+//------------------------------------------------------------------------------
+void CoreString::FormatTemplate::AddLiteral(std::string_view text)
+{
+    if(text.empty())
+        return;
+
+    // Extends the previous literal if it's the last thing on m_text.
+    if(!m_ops.empty()                        &&
+       m_ops.back().type == OpType::Literal &&
+       m_ops.back().offset + m_ops.back().size == m_text.size())
+    {
+        m_ops.back().size += uint32_t(text.size());
+    }
+    else
+    {
+        auto op   = Op();
+        op.type   = OpType::Literal;
+        op.offset = uint32_t(m_text.size());
+        op.size   = uint32_t(text.size());
+        m_ops.push_back(op);
+    }
+
+    m_text.append(text);
+    m_literalsSize += text.size();
+}
+
+//------------------------------------------------------------------------------
+bool CoreString::FormatTemplate::AddSlot(
+    std::string_view field,
+    std::string_view spec)
+{
+    auto op  = Op();
+    op.align = Align::Left;
+    op.fill  = ' ';
+    op.width = 0;
+
+    //--------------------------------------------------------------------------
+    // Spec: [[fill]align][width]
+    auto to_align = [](char c, Align &align) {
+        switch(c)
+        {
+            case '<' : align = Align::Left;   return true;
+            case '>' : align = Align::Right;  return true;
+            case '^' : align = Align::Center; return true;
+        }
+        return false;
+    };
+
+    if(spec.size() >= 2 && to_align(spec[1], op.align))
+    {
+        op.fill = spec[0];
+        spec.remove_prefix(2);
+    }
+    else if(!spec.empty() && to_align(spec[0], op.align))
+    {
+        spec.remove_prefix(1);
+    }
+
+    for(auto c : spec)
+    {
+        if(!isdigit((unsigned char)c))
+            return false;
+        op.width = op.width * 10 + uint32_t(c - '0');
+    }
+
+    //--------------------------------------------------------------------------
+    // Field: empty, index or name.
+    if(field.empty())
+    {
+        op.type  = OpType::Index;
+        op.index = uint32_t(m_slotsCount);
+    }
+    else if(isdigit((unsigned char)field[0]))
+    {
+        op.type  = OpType::Index;
+        op.index = 0;
+        for(auto c : field)
+        {
+            if(!isdigit((unsigned char)c))
+                return false;
+            op.index = op.index * 10 + uint32_t(c - '0');
+        }
+    }
+    else
+    {
+        if(field.find('{') != std::string_view::npos)
+            return false;
+
+        op.type   = OpType::Name;
+        op.offset = uint32_t(m_text.size());
+        op.size   = uint32_t(field.size());
+        m_text.append(field);
+    }
+
+    m_ops.push_back(op);
+    ++m_slotsCount;
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void CoreString::FormatTemplate::RenderRefs(
+    std::string  &out,
+    const ArgRef *args,
+    size_t        argsCount) const
+{
+    out.reserve(out.size() + m_literalsSize + 8 * m_slotsCount);
+
+    for(const auto &op : m_ops)
+    {
+        if(op.type == OpType::Literal)
+        {
+            out.append(m_text.data() + op.offset, op.size);
+            continue;
+        }
+
+        //----------------------------------------------------------------------
+        // Finds the argument - slots without one are left empty.
+        const ArgRef *arg = nullptr;
+        if(op.type == OpType::Index)
+        {
+            if(op.index < argsCount)
+                arg = args + op.index;
+        }
+        else
+        {
+            auto name = std::string_view(m_text.data() + op.offset, op.size);
+            for(auto i = size_t(0); i < argsCount && !arg; ++i)
+            {
+                if(args[i].name == name)
+                    arg = args + i;
+            }
+        }
+
+        auto begin = out.size();
+        if(arg)
+            arg->append(out, arg->value);
+
+        //----------------------------------------------------------------------
+        // Padding - as PadLeft, PadRight and Center.
+        auto size = out.size() - begin;
+        if(size >= op.width)
+            continue;
+
+        auto padding = op.width - size;
+        switch(op.align)
+        {
+            case Align::Left  : out.append(padding, op.fill);        break;
+            case Align::Right : out.insert(begin, padding, op.fill); break;
+            case Align::Center:
+                out.insert(begin, padding / 2, op.fill);
+                out.append(padding - padding / 2, op.fill);
+                break;
+        }
+    }
+}
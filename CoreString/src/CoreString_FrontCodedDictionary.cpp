@@ -0,0 +1,376 @@
+// Header
+#include "../include/CoreString_FrontCodedDictionary.h"
+// std
+#include <algorithm>
+#include <cstdint>
+// CoreString
+#include "CoreString_Simd.h"
+// CoreAssert
+#include "CoreAssert/CoreAssert.h"
+
+using namespace CoreString::Private_Simd;
+
+
+//------------------------------------------------------------------------------
+// Helper Functions.
+namespace {
+
+//------------------------------------------------------------------------------
+inline void WriteVarint(std::string &out, size_t value)
+{
+    while(value >= 0x80)
+    {
+        out.push_back(char(uint8_t(value) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(char(value));
+}
+
+inline size_t ReadVarint(const std::string &data, size_t &offset) noexcept
+{
+    auto value = size_t(0);
+    auto shift = 0;
+    while(true)
+    {
+        auto byte = uint8_t(data[offset++]);
+        value |= size_t(byte & 0x7F) << shift;
+        if(byte < 0x80)
+            return value;
+
+        shift += 7;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Whether a string that shares common chars with key comes after it -
+// strSize is its size and strChar its char at common, if it has one.
+//   In the prefix mode the strings that start with key don't.
+inline bool ComesAfter(
+    std::string_view key,
+    size_t           common,
+    size_t           strSize,
+    char             strChar,
+    bool             prefixMode) noexcept
+{
+    if(common == key.size())
+        return !prefixMode;
+    if(common == strSize)
+        return false;
+
+    return uint8_t(strChar) > uint8_t(key[common]);
+}
+
+inline bool ComesAfter(
+    std::string_view key,
+    std::string_view str,
+    size_t           common,
+    bool             prefixMode) noexcept
+{
+    auto str_char = (common < str.size()) ? str[common] : '\0';
+    return ComesAfter(key, common, str.size(), str_char, prefixMode);
+}
+
+} // Anonymous namespace.
+
+
+//------------------------------------------------------------------------------
+size_t CoreString::CommonPrefixLength(
+    std::string_view lhs,
+    std::string_view rhs) noexcept
+{
+    auto size = std::min(lhs.size(), rhs.size());
+    auto a    = lhs.data();
+    auto b    = rhs.data();
+    auto i    = size_t(0);
+
+#if CORESTRING_HAS_AVX2
+    for(; i + 32 <= size; i += 32)
+    {
+        auto equal = _mm256_cmpeq_epi8(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i)),
+            _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i))
+        );
+
+        auto mask = unsigned(_mm256_movemask_epi8(equal));
+        if(mask != 0xFFFFFFFFu)
+            return i + FirstSetBit(~mask);
+    }
+#endif // CORESTRING_HAS_AVX2
+
+#if CORESTRING_HAS_SSE2
+    for(; i + 16 <= size; i += 16)
+    {
+        auto mask = Mask16(_mm_cmpeq_epi8(Load16(a + i), Load16(b + i)));
+        if(mask != 0xFFFF)
+            return i + FirstSetBit(~mask);
+    }
+#endif // CORESTRING_HAS_SSE2
+
+    for(; i + 8 <= size; i += 8)
+    {
+        auto diff = LoadWord(a + i) ^ LoadWord(b + i);
+        if(diff != 0)
+            return i + FirstFlaggedByte(diff);
+    }
+
+    if(i < size)
+    {
+        auto diff = LoadPartialWord(a + i, size - i) ^ LoadPartialWord(b + i, size - i);
+        if(diff != 0)
+            return i + FirstFlaggedByte(diff);
+    }
+
+    return size;
+}
+
+
+//------------------------------------------------------------------------------
+CoreString::FrontCodedDictionary::FrontCodedDictionary() noexcept :
+    m_bucketSize(kDefaultBucketSize),
+    m_size      (0)
+{
+    // Empty...
+}
+
+//------------------------------------------------------------------------------
+CoreString::FrontCodedDictionary::FrontCodedDictionary(
+    const std::vector<std::string> &sortedStrings,
+    size_t                          bucketSize /* = kDefaultBucketSize */) :
+    FrontCodedDictionary(
+        std::vector<std::string_view>(std::begin(sortedStrings), std::end(sortedStrings)),
+        bucketSize
+    )
+{
+    // Empty...
+}
+
+//------------------------------------------------------------------------------
+CoreString::FrontCodedDictionary::FrontCodedDictionary(
+    const std::vector<std::string_view> &sortedStrings,
+    size_t                               bucketSize /* = kDefaultBucketSize */) :
+    m_bucketSize(bucketSize),
+    m_size      (0)
+{
+    COREASSERT_ASSERT(bucketSize != 0, "FrontCodedDictionary needs buckets of at least 1 string");
+
+    m_bucketsOffsets.reserve((sortedStrings.size() + bucketSize - 1) / bucketSize);
+
+    auto previous = std::string_view();
+    for(auto str : sortedStrings)
+    {
+        Append(str, previous);
+        previous = str;
+    }
+
+    m_data.shrink_to_fit();
+}
+
+
+//------------------------------------------------------------------------------
+size_t CoreString::FrontCodedDictionary::Find(std::string_view key) const noexcept
+{
+    auto found = false;
+    auto index = Search(key, false, found);
+
+    return (found) ? index : std::string::npos;
+}
+
+//------------------------------------------------------------------------------
+size_t CoreString::FrontCodedDictionary::LowerBound(std::string_view key) const noexcept
+{
+    auto found = false;
+    return Search(key, false, found);
+}
+
+//------------------------------------------------------------------------------
+std::pair<size_t, size_t> CoreString::FrontCodedDictionary::PrefixRange(
+    std::string_view prefix) const noexcept
+{
+    auto found = false;
+    auto first = Search(prefix, false, found);
+    auto last  = Search(prefix, true,  found);
+
+    return std::make_pair(first, last);
+}
+
+//------------------------------------------------------------------------------
+std::string CoreString::FrontCodedDictionary::At(size_t index) const
+{
+    COREASSERT_ASSERT(
+        index < m_size,
+        "Index (%zu) is out of the dictionary's bounds (%zu)",
+        index,
+        m_size
+    );
+
+    auto it  = FrontCodedIterator(*this, index);
+    auto str = std::string_view();
+    it.Next(str);
+
+    return std::string(str);
+}
+
+
+//------------------------------------------------------------------------------
+void CoreString::FrontCodedDictionary::Append(
+    std::string_view str,
+    std::string_view previous)
+{
+    COREASSERT_ASSERT(
+        m_size == 0 || previous <= str,
+        "FrontCodedDictionary needs the strings sorted (%zu is out of order)",
+        m_size
+    );
+
+    if(m_size % m_bucketSize == 0)
+    {
+        m_bucketsOffsets.push_back(m_data.size());
+        WriteVarint(m_data, str.size());
+        m_data.append(str);
+    }
+    else
+    {
+        auto shared = CommonPrefixLength(previous, str);
+        WriteVarint(m_data, shared);
+        WriteVarint(m_data, str.size() - shared);
+        m_data.append(str, shared);
+    }
+
+    ++m_size;
+}
+
+//------------------------------------------------------------------------------
+std::string_view CoreString::FrontCodedDictionary::Head(size_t bucket) const noexcept
+{
+    auto offset = m_bucketsOffsets[bucket];
+    auto size   = ReadVarint(m_data, offset);
+
+    return std::string_view(m_data.data() + offset, size);
+}
+
+//------------------------------------------------------------------------------
+size_t CoreString::FrontCodedDictionary::Search(
+    std::string_view key,
+    bool             prefixMode,
+    bool            &found) const noexcept
+{
+    found = false;
+
+    //--------------------------------------------------------------------------
+    // First bucket whose head comes after key - the string is in the
+    // bucket before it, or it's that head.
+    auto lo = size_t(0);
+    auto hi = m_bucketsOffsets.size();
+    while(lo < hi)
+    {
+        auto mid  = lo + (hi - lo) / 2;
+        auto head = Head(mid);
+        if(ComesAfter(key, head, CommonPrefixLength(key, head), prefixMode))
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+
+    auto found_head = [&](size_t bucket) {
+        if(bucket == m_bucketsOffsets.size())
+            return m_size;
+
+        found = !prefixMode && Head(bucket) == key;
+        return bucket * m_bucketSize;
+    };
+
+    if(lo == 0)
+        return found_head(0);
+
+    //--------------------------------------------------------------------------
+    // Walks the bucket keeping how many chars the previous string (that
+    // comes before key) shares with key. A string that shares more with
+    // the previous one than that comes before key as well, one that
+    // shares less comes after it - only the others need a comparison.
+    auto bucket = lo - 1;
+    auto offset = m_bucketsOffsets[bucket];
+    auto size   = ReadVarint(m_data, offset);
+    auto common = CommonPrefixLength(key, std::string_view(m_data.data() + offset, size));
+    offset += size;
+
+    auto index = bucket * m_bucketSize + 1;
+    auto end   = std::min(m_size, index - 1 + m_bucketSize);
+    for(; index < end; ++index)
+    {
+        auto shared      = ReadVarint(m_data, offset);
+        auto suffix_size = ReadVarint(m_data, offset);
+        auto suffix      = std::string_view(m_data.data() + offset, suffix_size);
+        offset += suffix_size;
+
+        if(shared > common)
+            continue;
+        if(shared < common)
+            return index;
+
+        auto str_common = common + CommonPrefixLength(key.substr(common), suffix);
+        auto str_size   = shared + suffix.size();
+        auto str_char   = (str_common < str_size) ? suffix[str_common - shared] : '\0';
+        if(ComesAfter(key, str_common, str_size, str_char, prefixMode))
+        {
+            found = !prefixMode && str_common == key.size() && str_size == key.size();
+            return index;
+        }
+
+        common = str_common;
+    }
+
+    return found_head(lo);
+}
+
+
+//------------------------------------------------------------------------------
+CoreString::FrontCodedIterator::FrontCodedIterator(
+    const FrontCodedDictionary &dictionary,
+    size_t                      index /* = 0 */) :
+    m_pDictionary(&dictionary),
+    m_offset     (0),
+    m_index      (0)
+{
+    if(index >= dictionary.m_size)
+    {
+        m_index = dictionary.m_size;
+        return;
+    }
+
+    // Starts at the head of the bucket and decodes up to index.
+    auto bucket = index / dictionary.m_bucketSize;
+    m_offset = dictionary.m_bucketsOffsets[bucket];
+    m_index  = bucket * dictionary.m_bucketSize;
+
+    auto skipped = std::string_view();
+    while(m_index < index)
+        Next(skipped);
+}
+
+//------------------------------------------------------------------------------
+bool CoreString::FrontCodedIterator::Next(std::string_view &str)
+{
+    const auto &dictionary = *m_pDictionary;
+    if(m_index == dictionary.m_size)
+        return false;
+
+    const auto &data = dictionary.m_data;
+    if(m_index % dictionary.m_bucketSize == 0)
+    {
+        auto size = ReadVarint(data, m_offset);
+        m_current.assign(data, m_offset, size);
+        m_offset += size;
+    }
+    else
+    {
+        auto shared = ReadVarint(data, m_offset);
+        auto size   = ReadVarint(data, m_offset);
+        m_current.resize(shared);
+        m_current.append(data, m_offset, size);
+        m_offset += size;
+    }
+
+    ++m_index;
+    str = m_current;
+    return true;
+}
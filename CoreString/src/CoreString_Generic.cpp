@@ -0,0 +1,236 @@
+// Header
+#include "../include/CoreString_Generic.h"
+// std
+#include <cstdint>
+// CoreString
+#include "CoreString_Simd.h"
+
+using namespace CoreString::Private_Simd;
+
+
+//------------------------------------------------------------------------------
+// Helper Functions.
+namespace {
+
+constexpr auto kNotFound = std::string_view::npos;
+
+// The sets with more chars than this are scanned one char at time.
+constexpr size_t kMaxVectorSet = 8;
+
+// The chars are read as bytes - see Private_Generic.
+template <typename Lane>
+inline Lane LoadLane(const void *data, size_t index) noexcept
+{
+    Lane lane;
+    std::memcpy(&lane, static_cast<const char *>(data) + index * sizeof(Lane), sizeof(Lane));
+    return lane;
+}
+
+template <typename Lane>
+inline bool InSet(Lane c, const void *set, size_t setSize) noexcept
+{
+    if(!set)
+        return c == Lane(' ') || (c >= Lane('\t') && c <= Lane('\r'));
+
+    for(auto i = size_t(0); i < setSize; ++i)
+    {
+        if(LoadLane<Lane>(set, i) == c)
+            return true;
+    }
+    return false;
+}
+
+#if CORESTRING_HAS_SSE2
+//------------------------------------------------------------------------------
+// The 16 bytes operations by size of the lanes.
+template <typename Lane> struct Lanes;
+
+template <> struct Lanes<uint16_t>
+{
+    static __m128i Set  (uint32_t c)         noexcept { return _mm_set1_epi16(short(c)); }
+    static __m128i Equal(__m128i a, __m128i b) noexcept { return _mm_cmpeq_epi16(a, b); }
+    static __m128i Less (__m128i a, __m128i b) noexcept { return _mm_cmplt_epi16(a, b); }
+    static __m128i Add  (__m128i a, __m128i b) noexcept { return _mm_add_epi16  (a, b); }
+};
+
+template <> struct Lanes<uint32_t>
+{
+    static __m128i Set  (uint32_t c)         noexcept { return _mm_set1_epi32(int(c)); }
+    static __m128i Equal(__m128i a, __m128i b) noexcept { return _mm_cmpeq_epi32(a, b); }
+    static __m128i Less (__m128i a, __m128i b) noexcept { return _mm_cmplt_epi32(a, b); }
+    static __m128i Add  (__m128i a, __m128i b) noexcept { return _mm_add_epi32  (a, b); }
+};
+
+//------------------------------------------------------------------------------
+// Flags the lanes of a block that are in the set - each lane sets all
+// its bits of the byte mask.
+template <typename Lane>
+class SetMatcher
+{
+    using Ops = Lanes<Lane>;
+
+    // The lanes are moved to put '\t'...'\r' at the bottom of the
+    // signed range, so a single signed compare checks it.
+    static constexpr auto kBias = Lane(Lane(1) << (sizeof(Lane) * 8 - 1));
+
+public:
+    SetMatcher(const void *set, size_t setSize) noexcept :
+        m_space       (Ops::Set(' ')),
+        m_shift       (Ops::Set(Lane(kBias - Lane('\t')))),
+        m_limit       (Ops::Set(Lane(kBias + Lane('\r' - '\t' + 1)))),
+        m_setSize     (setSize),
+        m_isWhiteSpace(set == nullptr)
+    {
+        for(auto i = size_t(0); i < setSize && set; ++i)
+            m_chars[i] = Ops::Set(LoadLane<Lane>(set, i));
+    }
+
+    unsigned Match(__m128i block) const noexcept
+    {
+        if(m_isWhiteSpace)
+        {
+            auto space = Ops::Equal(block, m_space);
+            auto range = Ops::Less(Ops::Add(block, m_shift), m_limit);
+            return Mask16(_mm_or_si128(space, range));
+        }
+
+        auto matches = _mm_setzero_si128();
+        for(auto i = size_t(0); i < m_setSize; ++i)
+            matches = _mm_or_si128(matches, Ops::Equal(block, m_chars[i]));
+
+        return Mask16(matches);
+    }
+
+private:
+    __m128i m_space;
+    __m128i m_shift;
+    __m128i m_limit;
+    __m128i m_chars[kMaxVectorSet];
+    size_t  m_setSize;
+    bool    m_isWhiteSpace;
+};
+#endif // CORESTRING_HAS_SSE2
+
+//------------------------------------------------------------------------------
+template <typename Lane>
+size_t FindFirstLane(
+    const void *str,
+    size_t      size,
+    const void *set,
+    size_t      setSize,
+    bool        inSet) noexcept
+{
+    auto i = size_t(0);
+
+#if CORESTRING_HAS_SSE2
+    constexpr auto kLanes = 16 / sizeof(Lane);
+    if(!set || setSize <= kMaxVectorSet)
+    {
+        auto matcher = SetMatcher<Lane>(set, setSize);
+        auto bytes   = static_cast<const char *>(str);
+
+        for(; i + kLanes <= size; i += kLanes)
+        {
+            auto mask = matcher.Match(Load16(bytes + i * sizeof(Lane)));
+            if(!inSet)
+                mask = ~mask & 0xFFFF;
+
+            if(mask != 0)
+                return i + FirstSetBit(mask) / sizeof(Lane);
+        }
+    }
+#endif // CORESTRING_HAS_SSE2
+
+    for(; i < size; ++i)
+    {
+        if(InSet(LoadLane<Lane>(str, i), set, setSize) == inSet)
+            return i;
+    }
+    return kNotFound;
+}
+
+//------------------------------------------------------------------------------
+template <typename Lane>
+size_t FindLastLane(
+    const void *str,
+    size_t      size,
+    const void *set,
+    size_t      setSize,
+    bool        inSet) noexcept
+{
+    // One past the char being checked.
+    auto end = size;
+
+#if CORESTRING_HAS_SSE2
+    constexpr auto kLanes = 16 / sizeof(Lane);
+    if(!set || setSize <= kMaxVectorSet)
+    {
+        auto matcher = SetMatcher<Lane>(set, setSize);
+        auto bytes   = static_cast<const char *>(str);
+
+        for(; end >= kLanes; end -= kLanes)
+        {
+            auto mask = matcher.Match(Load16(bytes + (end - kLanes) * sizeof(Lane)));
+            if(!inSet)
+                mask = ~mask & 0xFFFF;
+
+            if(mask != 0)
+                return end - kLanes + LastSetBit(mask) / sizeof(Lane);
+        }
+    }
+#endif // CORESTRING_HAS_SSE2
+
+    for(; end > 0; --end)
+    {
+        if(InSet(LoadLane<Lane>(str, end - 1), set, setSize) == inSet)
+            return end - 1;
+    }
+    return kNotFound;
+}
+
+} // Anonymous namespace.
+
+
+//------------------------------------------------------------------------------
+size_t CoreString::Private_Generic::FindFirst2(
+    const void *str,
+    size_t      size,
+    const void *set,
+    size_t      setSize,
+    bool        inSet) noexcept
+{
+    return FindFirstLane<uint16_t>(str, size, set, setSize, inSet);
+}
+
+//------------------------------------------------------------------------------
+size_t CoreString::Private_Generic::FindLast2(
+    const void *str,
+    size_t      size,
+    const void *set,
+    size_t      setSize,
+    bool        inSet) noexcept
+{
+    return FindLastLane<uint16_t>(str, size, set, setSize, inSet);
+}
+
+//------------------------------------------------------------------------------
+size_t CoreString::Private_Generic::FindFirst4(
+    const void *str,
+    size_t      size,
+    const void *set,
+    size_t      setSize,
+    bool        inSet) noexcept
+{
+    return FindFirstLane<uint32_t>(str, size, set, setSize, inSet);
+}
+
+//------------------------------------------------------------------------------
+size_t CoreString::Private_Generic::FindLast4(
+    const void *str,
+    size_t      size,
+    const void *set,
+    size_t      setSize,
+    bool        inSet) noexcept
+{
+    return FindLastLane<uint32_t>(str, size, set, setSize, inSet);
+}
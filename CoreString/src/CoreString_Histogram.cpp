@@ -0,0 +1,229 @@
+// Header
+#include "../include/CoreString_Histogram.h"
+// std
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+// CoreString
+#include "CoreString_Simd.h"
+
+using namespace CoreString::Private_Simd;
+
+
+//------------------------------------------------------------------------------
+// Helper Functions.
+namespace {
+
+constexpr size_t kMinBytesPerThread = 1024 * 1024;
+
+// Each table gets at most a quarter of a block, so their 32 bits
+// counters never overflow.
+constexpr size_t kBlockSize = size_t(1) << 30;
+
+// How many lines of the sample DetectDelimiter looks at.
+constexpr size_t kMaxSampleLines = 64;
+
+//------------------------------------------------------------------------------
+void CountBlock(CoreString::ByteHistogram &histogram, const char *data, size_t size)
+{
+    uint32_t counts[4][256] = {};
+
+    auto i = size_t(0);
+    for(; i + 8 <= size; i += 8)
+    {
+        auto word = LoadWord(data + i);
+        ++counts[0][uint8_t(word      )];
+        ++counts[1][uint8_t(word >>  8)];
+        ++counts[2][uint8_t(word >> 16)];
+        ++counts[3][uint8_t(word >> 24)];
+        ++counts[0][uint8_t(word >> 32)];
+        ++counts[1][uint8_t(word >> 40)];
+        ++counts[2][uint8_t(word >> 48)];
+        ++counts[3][uint8_t(word >> 56)];
+    }
+    for(; i < size; ++i)
+        ++counts[0][uint8_t(data[i])];
+
+    for(auto b = size_t(0); b < 256; ++b)
+    {
+        histogram[b] += uint64_t(counts[0][b]) + counts[1][b]
+                      + uint64_t(counts[2][b]) + counts[3][b];
+    }
+}
+
+void CountBytes(CoreString::ByteHistogram &histogram, std::string_view str)
+{
+    for(auto i = size_t(0); i < str.size(); i += kBlockSize)
+    {
+        auto size = std::min(kBlockSize, str.size() - i);
+        CountBlock(histogram, str.data() + i, size);
+    }
+}
+
+} // Anonymous namespace.
+
+
+//------------------------------------------------------------------------------
+CoreString::ByteHistogram CoreString::Histogram(
+    std::string_view str,
+    size_t           threadsCount /* = 0 */)
+{
+    auto histogram = ByteHistogram{};
+    HistogramTo(histogram, str, threadsCount);
+
+    return histogram;
+}
+
+//------------------------------------------------------------------------------
+void CoreString::HistogramTo(
+    ByteHistogram    &histogram,
+    std::string_view  str,
+    size_t            threadsCount /* = 0 */)
+{
+    if(threadsCount == 0)
+        threadsCount = std::max(1U, std::thread::hardware_concurrency());
+
+    threadsCount = std::max(size_t(1), std::min(threadsCount, str.size() / kMinBytesPerThread));
+    if(threadsCount == 1)
+    {
+        CountBytes(histogram, str);
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    // Each thread counts a slice on its own histogram, the calling
+    // thread takes the first one.
+    auto slice_size = (str.size() + threadsCount - 1) / threadsCount;
+    auto partials   = std::vector<ByteHistogram>(threadsCount, ByteHistogram{});
+
+    auto threads = std::vector<std::thread>();
+    for(auto t = size_t(1); t < threadsCount; ++t)
+    {
+        auto slice = str.substr(std::min(str.size(), t * slice_size), slice_size);
+        threads.emplace_back(CountBytes, std::ref(partials[t]), slice);
+    }
+
+    CountBytes(partials[0], str.substr(0, slice_size));
+    for(auto &thread : threads)
+        thread.join();
+
+    for(const auto &partial : partials)
+    {
+        for(auto b = size_t(0); b < 256; ++b)
+            histogram[b] += partial[b];
+    }
+}
+
+
+//------------------------------------------------------------------------------
+double CoreString::Entropy(const ByteHistogram &histogram) noexcept
+{
+    auto total = uint64_t(0);
+    for(auto count : histogram)
+        total += count;
+
+    if(total == 0)
+        return 0.0;
+
+    auto entropy = 0.0;
+    for(auto count : histogram)
+    {
+        if(count == 0)
+            continue;
+
+        auto p = double(count) / double(total);
+        entropy -= p * std::log2(p);
+    }
+
+    return entropy;
+}
+
+
+//------------------------------------------------------------------------------
+char CoreString::DetectDelimiter(
+    std::string_view sample,
+    std::string_view candidates /* = kDelimiterCandidates */)
+{
+    //--------------------------------------------------------------------------
+    // Index + 1 of each byte on the candidates, 0 for the other bytes -
+    // the first one wins if a byte is repeated.
+    candidates = candidates.substr(0, 255);
+
+    uint8_t indexes[256] = {};
+    for(auto i = candidates.size(); i > 0; --i)
+        indexes[uint8_t(candidates[i - 1])] = uint8_t(i);
+
+    //--------------------------------------------------------------------------
+    // Counts of each candidate by line - candidates.size() entries a line.
+    auto counts      = std::vector<uint32_t>();
+    auto lines_count = size_t(0);
+    auto in_quotes   = false;
+
+    auto index = size_t(0);
+    while(index < sample.size() && lines_count < kMaxSampleLines)
+    {
+        auto end = sample.find('\n', index);
+        if(end == std::string_view::npos)
+        {
+            // Cut by the end of the sample.
+            if(lines_count > 0)
+                break;
+            end = sample.size();
+        }
+
+        counts.resize(counts.size() + candidates.size(), 0);
+        auto line_counts = counts.data() + lines_count * candidates.size();
+
+        for(auto i = index; i < end; ++i)
+        {
+            auto c = sample[i];
+            if(c == '"')
+                in_quotes = !in_quotes;
+            else if(!in_quotes && indexes[uint8_t(c)] != 0)
+                ++line_counts[indexes[uint8_t(c)] - 1];
+        }
+
+        ++lines_count;
+        index = end + 1;
+    }
+
+    //--------------------------------------------------------------------------
+    // The score of a candidate is how many lines have its most common
+    // (non zero) count.
+    auto best        = '\0';
+    auto best_score  = size_t(0);
+    auto line_values = std::vector<uint32_t>();
+
+    for(auto c = size_t(0); c < candidates.size(); ++c)
+    {
+        line_values.clear();
+        for(auto line = size_t(0); line < lines_count; ++line)
+        {
+            auto count = counts[line * candidates.size() + c];
+            if(count != 0)
+                line_values.push_back(count);
+        }
+
+        std::sort(std::begin(line_values), std::end(line_values));
+
+        auto score = size_t(0);
+        for(auto i = size_t(0); i < line_values.size();)
+        {
+            auto run = i;
+            while(run < line_values.size() && line_values[run] == line_values[i])
+                ++run;
+
+            score = std::max(score, run - i);
+            i     = run;
+        }
+
+        if(score > best_score)
+        {
+            best       = candidates[c];
+            best_score = score;
+        }
+    }
+
+    return best;
+}
@@ -0,0 +1,202 @@
+// Header
+#include "../include/CoreString_InternPool.h"
+// std
+#include <cstring>
+// CoreAssert
+#include "CoreAssert/CoreAssert.h"
+
+
+//------------------------------------------------------------------------------
+// Helper Functions.
+namespace {
+
+template <typename Func>
+void SplitHelper(const std::string &str, const std::string &chars, Func func)
+{
+    auto index     = 0UL;
+    auto new_index = 0UL;
+    while(new_index != std::string::npos)
+    {
+        new_index = str.find_first_of(chars, index);
+
+        auto end = (new_index == std::string::npos) ? str.size() : new_index;
+        func(std::string_view(str.data() + index, end - index));
+
+        index = new_index + 1;
+    }
+}
+
+} // Anonymous namespace.
+
+
+//------------------------------------------------------------------------------
+std::string_view CoreString::InternPool::Intern(std::string_view str)
+{
+    auto hash        = std::hash<std::string_view>()(str);
+    auto shard_index = (hash >> 7) & (kShardsCount - 1);
+    auto &shard      = m_shards[shard_index];
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto id = InternLocked(shard, shard_index, str);
+
+    return shard.strings[id >> kShardBits];
+}
+
+//------------------------------------------------------------------------------
+CoreString::InternPool::Id
+CoreString::InternPool::InternId(std::string_view str)
+{
+    auto hash        = std::hash<std::string_view>()(str);
+    auto shard_index = (hash >> 7) & (kShardsCount - 1);
+    auto &shard      = m_shards[shard_index];
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return InternLocked(shard, shard_index, str);
+}
+
+//------------------------------------------------------------------------------
+CoreString::InternPool::Id
+CoreString::InternPool::Find(std::string_view str) const
+{
+    auto hash        = std::hash<std::string_view>()(str);
+    auto shard_index = (hash >> 7) & (kShardsCount - 1);
+    auto &shard      = m_shards[shard_index];
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.ids.find(str);
+
+    return (it != std::end(shard.ids)) ? it->second : kInvalidId;
+}
+
+//------------------------------------------------------------------------------
+std::string_view CoreString::InternPool::Lookup(Id id) const
+{
+    auto shard_index = (id & (kShardsCount - 1));
+    auto local_index = (id >> kShardBits);
+    auto &shard      = m_shards[shard_index];
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    COREASSERT_ASSERT(
+        local_index < shard.strings.size(),
+        "Invalid InternPool id (%u)",
+        id
+    );
+
+    return shard.strings[local_index];
+}
+
+//------------------------------------------------------------------------------
+size_t CoreString::InternPool::Size() const
+{
+    auto size = 0UL;
+    for(const auto &shard : m_shards)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        size += shard.strings.size();
+    }
+
+    return size;
+}
+
+//------------------------------------------------------------------------------
+size_t CoreString::InternPool::ArenaBytes() const
+{
+    auto size = 0UL;
+    for(const auto &shard : m_shards)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        size += shard.allocatedSize;
+    }
+
+    return size;
+}
+
+
+//------------------------------------------------------------------------------
+CoreString::InternPool::Id CoreString::InternPool::InternLocked(
+    Shard            &shard,
+    size_t            shardIndex,
+    std::string_view  str)
+{
+    auto it = shard.ids.find(str);
+    if(it != std::end(shard.ids))
+        return it->second;
+
+    // Copy the string to the arena so the key stays valid
+    // regardless of the lifetime of the caller's buffer.
+    auto data = Allocate(shard, str.size());
+    std::memcpy(data, str.data(), str.size());
+
+    auto view = std::string_view(data, str.size());
+
+    auto id = Id((shard.strings.size() << kShardBits) | shardIndex);
+    shard.strings.push_back(view);
+    shard.ids.emplace(view, id);
+
+    return id;
+}
+
+//------------------------------------------------------------------------------
+char* CoreString::InternPool::Allocate(Shard &shard, size_t size)
+{
+    // Big strings get a block of their own, this way
+    // we don't waste the rest of the current block.
+    if(size > kBlockSize / 4)
+    {
+        shard.blocks.emplace_back(new char[size]);
+        shard.allocatedSize += size;
+
+        return shard.blocks.back().get();
+    }
+
+    if(!shard.currentBlock || shard.blockUsed + size > kBlockSize)
+    {
+        shard.blocks.emplace_back(new char[kBlockSize]);
+        shard.currentBlock   = shard.blocks.back().get();
+        shard.blockUsed      = 0;
+        shard.allocatedSize += kBlockSize;
+    }
+
+    auto data = shard.currentBlock + shard.blockUsed;
+    shard.blockUsed += size;
+
+    return data;
+}
+
+
+//------------------------------------------------------------------------------
+std::vector<std::string_view> CoreString::Split(
+    const std::string &str,
+    const std::string &chars,
+    InternPool        &pool)
+{
+    auto vec = std::vector<std::string_view>();
+    SplitHelper(str, chars, [&vec, &pool](std::string_view token) {
+        vec.push_back(pool.Intern(token));
+    });
+
+    return vec;
+}
+
+//------------------------------------------------------------------------------
+std::vector<std::string_view> CoreString::Split(
+    const std::string &str,
+    char               c,
+    InternPool        &pool)
+{
+    return CoreString::Split(str, std::string(1, c), pool);
+}
+
+//------------------------------------------------------------------------------
+std::vector<CoreString::InternPool::Id> CoreString::SplitIds(
+    const std::string &str,
+    const std::string &chars,
+    InternPool        &pool)
+{
+    auto vec = std::vector<InternPool::Id>();
+    SplitHelper(str, chars, [&vec, &pool](std::string_view token) {
+        vec.push_back(pool.InternId(token));
+    });
+
+    return vec;
+}
@@ -0,0 +1,124 @@
+// Header
+#include "../include/CoreString_KeyValueParser.h"
+// std
+#include <algorithm>
+// CoreString
+#include "../include/CoreString_WhiteSpace.h"
+
+
+//------------------------------------------------------------------------------
+// Helper Functions.
+namespace {
+
+inline int HexValue(char c) noexcept
+{
+    if(c >= '0' && c <= '9') return c - '0';
+    if(c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if(c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Malformed escapes are kept as they are, as Unescape does.
+void PercentDecodeTo(std::string &out, std::string_view str, bool plusAsSpace)
+{
+    out.clear();
+    out.reserve(str.size());
+
+    for(auto i = size_t(0); i < str.size(); ++i)
+    {
+        auto c = str[i];
+        if(c == '+' && plusAsSpace)
+        {
+            out.push_back(' ');
+            continue;
+        }
+
+        if(c == '%' && i + 2 < str.size())
+        {
+            auto hi = HexValue(str[i + 1]);
+            auto lo = HexValue(str[i + 2]);
+            if(hi >= 0 && lo >= 0)
+            {
+                out.push_back(char((hi << 4) | lo));
+                i += 2;
+                continue;
+            }
+        }
+
+        out.push_back(c);
+    }
+}
+
+} // Anonymous namespace.
+
+
+//------------------------------------------------------------------------------
+CoreString::KeyValueParser::KeyValueParser(
+    std::string_view       input,
+    const KeyValueOptions &options /* = KeyValueOptions() */) :
+    m_input   (input),
+    m_options (options),
+    m_position(0)
+{
+    // Empty...
+}
+
+
+//------------------------------------------------------------------------------
+bool CoreString::KeyValueParser::Next(
+    std::string_view &key,
+    std::string_view &value)
+{
+    while(m_position < m_input.size())
+    {
+        auto end = m_input.find(m_options.pairSeparator, m_position);
+        if(end == std::string_view::npos)
+            end = m_input.size();
+
+        auto pair = m_input.substr(m_position, end - m_position);
+        m_position = std::min(end + 1, m_input.size());
+
+        if(m_options.trim)
+            pair = TrimWhiteSpace(pair);
+        if(pair.empty())
+            continue;
+
+        auto assign = pair.find(m_options.assignSeparator);
+        if(assign == std::string_view::npos)
+        {
+            key   = Clean(pair, m_keyBuffer);
+            value = std::string_view();
+        }
+        else
+        {
+            key   = Clean(pair.substr(0, assign), m_keyBuffer);
+            value = Clean(pair.substr(assign + 1), m_valueBuffer);
+        }
+
+        return true;
+    }
+
+    m_position = m_input.size();
+    return false;
+}
+
+
+//------------------------------------------------------------------------------
+std::string_view CoreString::KeyValueParser::Clean(
+    std::string_view  str,
+    std::string      &buffer) const
+{
+    if(m_options.trim)
+        str = TrimWhiteSpace(str);
+
+    if(!m_options.percentDecode)
+        return str;
+
+    // Only what has escapes is copied.
+    auto escapes = (m_options.plusAsSpace) ? "%+" : "%";
+    if(str.find_first_of(escapes) == std::string_view::npos)
+        return str;
+
+    PercentDecodeTo(buffer, str, m_options.plusAsSpace);
+    return buffer;
+}
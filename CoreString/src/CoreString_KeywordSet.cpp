@@ -0,0 +1,82 @@
+// Header
+#include "../include/CoreString_KeywordSet.h"
+// CoreAssert
+#include "CoreAssert/CoreAssert.h"
+
+using namespace CoreString::Private_KeywordSet;
+
+
+//------------------------------------------------------------------------------
+CoreString::KeywordSet::KeywordSet(const std::vector<std::string> &keywords) :
+    m_seed(0)
+{
+    //--------------------------------------------------------------------------
+    // All the keywords in a single buffer.
+    auto total_size = size_t(0);
+    for(const auto &keyword : keywords)
+        total_size += keyword.size();
+
+    m_data.reserve(total_size);
+    m_offsets.reserve(keywords.size() + 1);
+    for(const auto &keyword : keywords)
+    {
+        m_offsets.push_back(uint32_t(m_data.size()));
+        m_data.append(keyword);
+    }
+    m_offsets.push_back(uint32_t(m_data.size()));
+
+    //--------------------------------------------------------------------------
+    // The table.
+    auto keys_count    = keywords.size();
+    auto buckets_count = BucketsCount(keys_count);
+
+    auto keys = std::vector<std::string_view>(std::begin(keywords), std::end(keywords));
+    m_slots        .resize(keys_count);
+    m_displacements.resize(buckets_count);
+
+    auto hashes        = std::vector<uint64_t>(keys_count);
+    auto bucket_starts = std::vector<uint32_t>(buckets_count + 1);
+    auto bucket_keys   = std::vector<uint32_t>(keys_count);
+    auto buckets_order = std::vector<uint32_t>(buckets_count);
+
+    auto buffers = Buffers{
+        keys           .data(),
+        m_slots        .data(),
+        m_displacements.data(),
+        hashes         .data(),
+        bucket_starts  .data(),
+        bucket_keys    .data(),
+        buckets_order  .data()
+    };
+
+    while(m_seed < kSeedsCount && !Build(buffers, keys_count, m_seed))
+        ++m_seed;
+
+    COREASSERT_ASSERT(
+        m_seed < kSeedsCount,
+        "KeywordSet couldn't find a perfect hash for %zu keywords",
+        keys_count
+    );
+}
+
+
+//------------------------------------------------------------------------------
+size_t CoreString::KeywordSet::Find(std::string_view str) const noexcept
+{
+    auto keys_count = m_slots.size();
+    if(keys_count == 0)
+        return std::string::npos;
+
+    auto hash   = Hash64(str, m_seed);
+    auto bucket = Bucket(hash, m_displacements.size());
+    auto key    = m_slots[Slot(hash, m_displacements[bucket], keys_count)];
+    if(key == kEmpty)
+        return std::string::npos;
+
+    auto offset = m_offsets[key];
+    auto size   = m_offsets[key + 1] - offset;
+    if(std::string_view(m_data.data() + offset, size) != str)
+        return std::string::npos;
+
+    return key;
+}
@@ -0,0 +1,312 @@
+// Header
+#include "../include/CoreString_Pipe.h"
+// std
+#include <array>
+// CoreString
+#include "../include/CoreString.h"
+
+
+//------------------------------------------------------------------------------
+// Helper Functions.
+namespace {
+
+using Table = std::array<uint8_t, 256>;
+
+Table MakeTable(char (*func)(char))
+{
+    auto table = Table();
+    for(auto i = size_t(0); i < table.size(); ++i)
+        table[i] = uint8_t(func(char(i)));
+
+    return table;
+}
+
+// The map of the bytes that the pending Map stages make, composed into
+// a single table - or none while there's no Map stage.
+class PendingMap
+{
+public:
+    PendingMap() :
+        m_pTable(nullptr)
+    {
+        // Empty...
+    }
+
+    const uint8_t* Get() const noexcept { return m_pTable; }
+    void Clear() noexcept { m_pTable = nullptr; }
+
+    // Applies the table after the current map.
+    void Then(const uint8_t *pTable) noexcept
+    {
+        if(!m_pTable)
+        {
+            m_pTable = pTable;
+            return;
+        }
+
+        for(auto i = size_t(0); i < m_composed.size(); ++i)
+            m_composed[i] = pTable[m_pTable[i]];
+        m_pTable = m_composed.data();
+    }
+
+    // The table is copied since it can be the next m_composed.
+    void Then(const Table &table) noexcept
+    {
+        if(!m_pTable)
+        {
+            m_composed = table;
+            m_pTable   = m_composed.data();
+            return;
+        }
+
+        Then(table.data());
+    }
+
+private:
+    const uint8_t *m_pTable;
+    Table          m_composed;
+};
+
+//------------------------------------------------------------------------------
+void MapTo(std::string &out, std::string_view str, const uint8_t *pTable)
+{
+    auto start = out.size();
+    out.resize(start + str.size());
+
+    auto dst = &out[start];
+    for(auto i = size_t(0); i < str.size(); ++i)
+        dst[i] = char(pTable[uint8_t(str[i])]);
+}
+
+// Narrows str by the chars that, after the map, are in chars.
+std::string_view TrimMapped(
+    std::string_view  str,
+    std::string_view  chars,
+    const uint8_t    *pTable,
+    bool              start,
+    bool              end)
+{
+    bool trimmed[256];
+    for(auto i = size_t(0); i < 256; ++i)
+        trimmed[i] = chars.find(char(pTable[i])) != std::string_view::npos;
+
+    auto begin = size_t(0);
+    auto size  = str.size();
+    if(start)
+    {
+        while(begin < size && trimmed[uint8_t(str[begin])])
+            ++begin;
+    }
+    if(end)
+    {
+        while(size > begin && trimmed[uint8_t(str[size - 1])])
+            --size;
+    }
+
+    return str.substr(begin, size - begin);
+}
+
+std::string_view TrimView(
+    std::string_view str,
+    std::string_view chars,
+    bool             start,
+    bool             end)
+{
+    auto begin = (start)
+        ? CoreString::Private_WhiteSpace::FindFirstNotOf(str, chars)
+        : size_t(0);
+    if(begin == std::string_view::npos || str.empty())
+        return std::string_view();
+
+    auto last = (end)
+        ? CoreString::Private_WhiteSpace::FindLastNotOf(str, chars)
+        : str.size() - 1;
+
+    return str.substr(begin, last - begin + 1);
+}
+
+} // Anonymous namespace.
+
+
+//------------------------------------------------------------------------------
+CoreString::PipeStage CoreString::Stages::Trim(
+    std::string_view chars /* = kWhiteSpaceChars */) noexcept
+{
+    return PipeStage{ PipeStage::Kind::Trim, nullptr, nullptr, chars, {} };
+}
+
+//------------------------------------------------------------------------------
+CoreString::PipeStage CoreString::Stages::TrimStart(
+    std::string_view chars /* = kWhiteSpaceChars */) noexcept
+{
+    return PipeStage{ PipeStage::Kind::TrimStart, nullptr, nullptr, chars, {} };
+}
+
+//------------------------------------------------------------------------------
+CoreString::PipeStage CoreString::Stages::TrimEnd(
+    std::string_view chars /* = kWhiteSpaceChars */) noexcept
+{
+    return PipeStage{ PipeStage::Kind::TrimEnd, nullptr, nullptr, chars, {} };
+}
+
+//------------------------------------------------------------------------------
+CoreString::PipeStage CoreString::Stages::Replace(
+    std::string_view what,
+    std::string_view to) noexcept
+{
+    return PipeStage{ PipeStage::Kind::Replace, nullptr, nullptr, what, to };
+}
+
+//------------------------------------------------------------------------------
+CoreString::PipeStage CoreString::Stages::ToLower() noexcept
+{
+    static const auto s_table = MakeTable(Private_Case::ToLower);
+    return PipeStage{ PipeStage::Kind::Map, s_table.data(), nullptr, {}, {} };
+}
+
+//------------------------------------------------------------------------------
+CoreString::PipeStage CoreString::Stages::ToUpper() noexcept
+{
+    static const auto s_table = MakeTable(Private_Case::ToUpper);
+    return PipeStage{ PipeStage::Kind::Map, s_table.data(), nullptr, {}, {} };
+}
+
+//------------------------------------------------------------------------------
+CoreString::PipeStage CoreString::Stages::SwapCase() noexcept
+{
+    static const auto s_table = MakeTable(Private_Case::SwapCase);
+    return PipeStage{ PipeStage::Kind::Map, s_table.data(), nullptr, {}, {} };
+}
+
+//------------------------------------------------------------------------------
+CoreString::PipeStage CoreString::Stages::Map(char (*func)(char)) noexcept
+{
+    return PipeStage{ PipeStage::Kind::Map, nullptr, func, {}, {} };
+}
+
+
+//------------------------------------------------------------------------------
+CoreString::Pipe::Pipe(std::string_view str) :
+    m_source(str)
+{
+    // Empty...
+}
+
+
+//------------------------------------------------------------------------------
+CoreString::Pipe& CoreString::Pipe::Then(const PipeStage &stage)
+{
+    m_stages.push_back(stage);
+    return *this;
+}
+
+//------------------------------------------------------------------------------
+std::string CoreString::Pipe::ToString() const
+{
+    auto str = std::string();
+    To(str);
+
+    return str;
+}
+
+//------------------------------------------------------------------------------
+void CoreString::Pipe::To(std::string &out) const
+{
+    //--------------------------------------------------------------------------
+    // The maps are only composed and the trims only narrow the view, the
+    // length changing replaces are the only stages that write - each one
+    // to the buffer that the current view isn't on.
+    auto view    = m_source;
+    auto map     = PendingMap();
+    auto buffers = std::array<std::string, 2>();
+    auto current = size_t(0);
+
+    for(const auto &stage : m_stages)
+    {
+        switch(stage.kind)
+        {
+            case PipeStage::Kind::Map:
+            {
+                if(stage.pTable)
+                    map.Then(stage.pTable);
+                else
+                    map.Then(MakeTable(stage.pFunc));
+            } break;
+
+            case PipeStage::Kind::Trim:
+            case PipeStage::Kind::TrimStart:
+            case PipeStage::Kind::TrimEnd:
+            {
+                auto start = stage.kind != PipeStage::Kind::TrimEnd;
+                auto end   = stage.kind != PipeStage::Kind::TrimStart;
+
+                view = (map.Get())
+                    ? TrimMapped(view, stage.what, map.Get(), start, end)
+                    : TrimView  (view, stage.what,            start, end);
+            } break;
+
+            case PipeStage::Kind::Replace:
+            {
+                if(stage.what.empty())
+                    break;
+
+                // Char by char - it's just another map.
+                if(stage.what.size() == 1 && stage.to.size() == 1)
+                {
+                    auto table = Table();
+                    for(auto i = size_t(0); i < table.size(); ++i)
+                        table[i] = uint8_t(i);
+                    table[uint8_t(stage.what[0])] = uint8_t(stage.to[0]);
+
+                    map.Then(table);
+                    break;
+                }
+
+                // The occurrences are of the mapped string.
+                if(map.Get())
+                {
+                    auto &mapped = buffers[current];
+                    mapped.clear();
+                    MapTo(mapped, view, map.Get());
+
+                    view    = mapped;
+                    current = 1 - current;
+                    map.Clear();
+                }
+
+                // It never grows if to isn't bigger than what.
+                auto size = view.size();
+                if(stage.to.size() > stage.what.size())
+                {
+                    auto count = size_t(0);
+                    for(auto index = view.find(stage.what);
+                        index != std::string_view::npos;
+                        index = view.find(stage.what, index + stage.what.size()))
+                    {
+                        ++count;
+                    }
+                    size += count * (stage.to.size() - stage.what.size());
+                }
+
+                auto &replaced = buffers[current];
+                replaced.clear();
+                replaced.reserve(size);
+                ReplaceTo(replaced, view, stage.what, stage.to);
+
+                view    = replaced;
+                current = 1 - current;
+            } break;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // The single pass over what's left.
+    if(map.Get())
+    {
+        MapTo(out, view, map.Get());
+    }
+    else
+    {
+        out.append(view);
+    }
+}
@@ -0,0 +1,569 @@
+// Header
+#include "../include/CoreString_Rope.h"
+// std
+#include <algorithm>
+#include <utility>
+// CoreAssert
+#include "CoreAssert/CoreAssert.h"
+
+using namespace CoreString::Private_Rope;
+
+
+//------------------------------------------------------------------------------
+// Helper Functions.
+namespace {
+
+// Pieces up to this size are merged with their neighbour chunk.
+constexpr size_t kMergeSize = 512;
+
+typedef std::pair<NodePtr, NodePtr> NodePair;
+
+//------------------------------------------------------------------------------
+NodePtr MakeLeaf(std::shared_ptr<const std::string> buffer, size_t offset, size_t size)
+{
+    auto node    = std::make_shared<Node>();
+    node->buffer = std::move(buffer);
+    node->offset = offset;
+    node->size   = size;
+    node->height = 0;
+
+    return node;
+}
+
+//------------------------------------------------------------------------------
+NodePtr MakeLeaf(std::string &&str)
+{
+    if(str.empty())
+        return nullptr;
+
+    auto size = str.size();
+    return MakeLeaf(std::make_shared<const std::string>(std::move(str)), 0, size);
+}
+
+//------------------------------------------------------------------------------
+NodePtr MakeNode(NodePtr left, NodePtr right)
+{
+    auto node    = std::make_shared<Node>();
+    node->offset = 0;
+    node->size   = left->size + right->size;
+    node->height = std::max(left->height, right->height) + 1;
+    node->left   = std::move(left);
+    node->right  = std::move(right);
+
+    return node;
+}
+
+//------------------------------------------------------------------------------
+// ((a, b), c) <- (a, (b, c)) and back.
+NodePtr RotateLeft(const NodePtr &node)
+{
+    return MakeNode(MakeNode(node->left, node->right->left), node->right->right);
+}
+
+NodePtr RotateRight(const NodePtr &node)
+{
+    return MakeNode(node->left->left, MakeNode(node->left->right, node->right));
+}
+
+//------------------------------------------------------------------------------
+// Concatenation of AVL trees: goes down the taller tree's spine until the
+// heights are close enough and rebalances back up - O(height difference).
+// (As in Blelloch et al, "Just Join for Parallel Ordered Sets").
+NodePtr JoinRight(const NodePtr &left, const NodePtr &right)
+{
+    const auto &l = left->left;
+    const auto &c = left->right;
+
+    if(c->height <= right->height + 1)
+    {
+        auto node = MakeNode(c, right);
+        if(node->height <= l->height + 1)
+            return MakeNode(l, node);
+
+        return RotateLeft(MakeNode(l, RotateRight(node)));
+    }
+
+    auto node = JoinRight(c, right);
+    if(node->height <= l->height + 1)
+        return MakeNode(l, node);
+
+    return RotateLeft(MakeNode(l, node));
+}
+
+//------------------------------------------------------------------------------
+NodePtr JoinLeft(const NodePtr &left, const NodePtr &right)
+{
+    const auto &c = right->left;
+    const auto &r = right->right;
+
+    if(c->height <= left->height + 1)
+    {
+        auto node = MakeNode(left, c);
+        if(node->height <= r->height + 1)
+            return MakeNode(node, r);
+
+        return RotateRight(MakeNode(RotateLeft(node), r));
+    }
+
+    auto node = JoinLeft(left, c);
+    if(node->height <= r->height + 1)
+        return MakeNode(node, r);
+
+    return RotateRight(MakeNode(node, r));
+}
+
+//------------------------------------------------------------------------------
+NodePtr Join(const NodePtr &left, const NodePtr &right)
+{
+    if(!left ) return right;
+    if(!right) return left;
+
+    if(left ->height > right->height + 1) return JoinRight(left, right);
+    if(right->height > left ->height + 1) return JoinLeft (left, right);
+
+    return MakeNode(left, right);
+}
+
+//------------------------------------------------------------------------------
+// Splits in [0, index) and [index, size) - the leaf that has index
+// becomes two leaves of the same buffer.
+NodePair SplitAt(const NodePtr &node, size_t index)
+{
+    if(!node || index == 0)  return NodePair(nullptr, node);
+    if(index >= node->size)  return NodePair(node, nullptr);
+
+    if(node->IsLeaf())
+    {
+        return NodePair(
+            MakeLeaf(node->buffer, node->offset,         index),
+            MakeLeaf(node->buffer, node->offset + index, node->size - index)
+        );
+    }
+
+    auto left_size = node->left->size;
+    if(index == left_size)
+        return NodePair(node->left, node->right);
+
+    if(index < left_size)
+    {
+        auto parts = SplitAt(node->left, index);
+        return NodePair(parts.first, Join(parts.second, node->right));
+    }
+
+    auto parts = SplitAt(node->right, index - left_size);
+    return NodePair(Join(node->left, parts.first), parts.second);
+}
+
+//------------------------------------------------------------------------------
+void AppendText(std::string &out, const NodePtr &node)
+{
+    if(!node)
+        return;
+
+    if(node->IsLeaf())
+    {
+        out.append(node->Text());
+        return;
+    }
+
+    AppendText(out, node->left);
+    AppendText(out, node->right);
+}
+
+//------------------------------------------------------------------------------
+const Node* Leftmost(const Node *node) noexcept
+{
+    while(!node->IsLeaf())
+        node = node->left.get();
+    return node;
+}
+
+const Node* Rightmost(const Node *node) noexcept
+{
+    while(!node->IsLeaf())
+        node = node->right.get();
+    return node;
+}
+
+//------------------------------------------------------------------------------
+// Join that merges a small side with the chunk that it touches,
+// so appending small pieces doesn't grow the tree one leaf at time.
+NodePtr Concat(const NodePtr &left, const NodePtr &right)
+{
+    if(!left || !right)
+        return Join(left, right);
+
+    if(right->size <= kMergeSize)
+    {
+        auto last = Rightmost(left.get());
+        if(last->size + right->size <= kMergeSize)
+        {
+            auto text = std::string(last->Text());
+            AppendText(text, right);
+
+            auto head = SplitAt(left, left->size - last->size).first;
+            return Join(head, MakeLeaf(std::move(text)));
+        }
+    }
+
+    if(left->size <= kMergeSize)
+    {
+        auto first = Leftmost(right.get());
+        if(first->size + left->size <= kMergeSize)
+        {
+            auto text = std::string();
+            AppendText(text, left);
+            text.append(first->Text());
+
+            auto tail = SplitAt(right, first->size).second;
+            return Join(MakeLeaf(std::move(text)), tail);
+        }
+    }
+
+    return Join(left, right);
+}
+
+//------------------------------------------------------------------------------
+// Calls func with the start of each non-overlapping occurrence of needle
+// from start on, until it returns false.
+//   Each chunk is searched by itself and the matches that cross into it
+//   are searched on the previous (needle.size() - 1) chars followed by
+//   the start of the chunk.
+template <typename Func>
+void ForEachMatch(
+    const CoreString::Rope &rope,
+    std::string_view        needle,
+    size_t                  start,
+    Func                    func)
+{
+    auto overlap  = needle.size() - 1;
+    auto window   = std::string(); // The overlap chars before the chunk.
+    auto boundary = std::string();
+    auto next     = start;         // Where the next match can start.
+
+    CoreString::RopeChunkIterator it(rope, start);
+    auto chunk_begin = it.Position();
+
+    std::string_view chunk;
+    while(it.Next(chunk))
+    {
+        //----------------------------------------------------------------------
+        // Matches that start on the window.
+        if(!window.empty())
+        {
+            auto window_begin = chunk_begin - window.size();
+
+            boundary.assign(window);
+            boundary.append(chunk.substr(0, overlap));
+
+            auto index = (next > window_begin) ? next - window_begin : 0;
+            while(index < window.size())
+            {
+                auto found = boundary.find(needle, index);
+                if(found == std::string::npos || found >= window.size())
+                    break;
+
+                if(!func(window_begin + found))
+                    return;
+
+                next  = window_begin + found + needle.size();
+                index = found + needle.size();
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // Matches inside the chunk.
+        auto index = (next > chunk_begin) ? next - chunk_begin : 0;
+        while(index < chunk.size())
+        {
+            auto found = chunk.find(needle, index);
+            if(found == std::string_view::npos)
+                break;
+
+            if(!func(chunk_begin + found))
+                return;
+
+            next  = chunk_begin + found + needle.size();
+            index = found + needle.size();
+        }
+
+        //----------------------------------------------------------------------
+        // Keeps the last chars for the next boundary.
+        if(overlap != 0)
+        {
+            window.append(chunk.size() > overlap ? chunk.substr(chunk.size() - overlap) : chunk);
+            if(window.size() > overlap)
+                window.erase(0, window.size() - overlap);
+        }
+
+        chunk_begin = it.Position();
+    }
+}
+
+} // Anonymous namespace.
+
+
+//------------------------------------------------------------------------------
+CoreString::Rope::Rope(std::string_view str) :
+    m_root(MakeLeaf(std::string(str)))
+{
+    // Empty...
+}
+
+//------------------------------------------------------------------------------
+CoreString::Rope::Rope(std::string &&str) :
+    m_root(MakeLeaf(std::move(str)))
+{
+    // Empty...
+}
+
+
+//------------------------------------------------------------------------------
+char CoreString::Rope::At(size_t index) const noexcept
+{
+    COREASSERT_ASSERT(
+        index < Size(),
+        "index(%zu) isn't in rope bounds[0, %zu)",
+        index,
+        Size()
+    );
+
+    auto node = m_root.get();
+    while(!node->IsLeaf())
+    {
+        if(index < node->left->size)
+        {
+            node = node->left.get();
+        }
+        else
+        {
+            index -= node->left->size;
+            node   = node->right.get();
+        }
+    }
+
+    return node->Text()[index];
+}
+
+//------------------------------------------------------------------------------
+void CoreString::Rope::Append(std::string_view str)
+{
+    m_root = Concat(m_root, MakeLeaf(std::string(str)));
+}
+
+//------------------------------------------------------------------------------
+void CoreString::Rope::Append(const Rope &rope)
+{
+    m_root = Concat(m_root, rope.m_root);
+}
+
+//------------------------------------------------------------------------------
+void CoreString::Rope::Insert(size_t index, std::string_view str)
+{
+    Insert(index, Rope(str));
+}
+
+//------------------------------------------------------------------------------
+void CoreString::Rope::Insert(size_t index, const Rope &rope)
+{
+    auto parts = SplitAt(m_root, index);
+    m_root = Concat(Concat(parts.first, rope.m_root), parts.second);
+}
+
+//------------------------------------------------------------------------------
+void CoreString::Rope::Erase(
+    size_t index,
+    size_t count /* = std::string::npos */)
+{
+    if(index >= Size())
+        return;
+
+    count = std::min(count, Size() - index);
+
+    auto head = SplitAt(m_root, index);
+    auto tail = SplitAt(head.second, count).second;
+    m_root = Concat(head.first, tail);
+}
+
+//------------------------------------------------------------------------------
+CoreString::Rope CoreString::Rope::Substr(
+    size_t index,
+    size_t count /* = std::string::npos */) const
+{
+    if(index >= Size())
+        return Rope();
+
+    count = std::min(count, Size() - index);
+
+    auto tail = SplitAt(m_root, index).second;
+    return Rope(SplitAt(tail, count).first);
+}
+
+//------------------------------------------------------------------------------
+std::string CoreString::Rope::Flatten() const
+{
+    auto str = std::string();
+    str.reserve(Size());
+    AppendText(str, m_root);
+
+    return str;
+}
+
+
+//------------------------------------------------------------------------------
+CoreString::RopeChunkIterator::RopeChunkIterator(
+    const Rope &rope,
+    size_t      position /* = 0 */) :
+    m_skip    (0),
+    m_position(position)
+{
+    auto node = rope.Root().get();
+    if(!node || position >= node->size)
+        return;
+
+    // Goes down to the leaf that has the position, what is on
+    // the right of the path is visited later.
+    while(!node->IsLeaf())
+    {
+        if(position < node->left->size)
+        {
+            m_stack.push_back(node->right.get());
+            node = node->left.get();
+        }
+        else
+        {
+            position -= node->left->size;
+            node      = node->right.get();
+        }
+    }
+
+    m_stack.push_back(node);
+    m_skip = position;
+}
+
+
+//------------------------------------------------------------------------------
+bool CoreString::RopeChunkIterator::Next(std::string_view &chunk)
+{
+    if(m_stack.empty())
+        return false;
+
+    auto node = m_stack.back();
+    m_stack.pop_back();
+
+    while(!node->IsLeaf())
+    {
+        m_stack.push_back(node->right.get());
+        node = node->left.get();
+    }
+
+    chunk       = node->Text().substr(m_skip);
+    m_skip      = 0;
+    m_position += chunk.size();
+
+    return true;
+}
+
+
+//------------------------------------------------------------------------------
+size_t CoreString::Find(
+    const Rope       &rope,
+    std::string_view  needle,
+    size_t            start /* = 0 */)
+{
+    if(needle.empty())
+        return (start <= rope.Size()) ? start : std::string::npos;
+
+    auto index = std::string::npos;
+    ForEachMatch(rope, needle, start, [&index](size_t found) {
+        index = found;
+        return false;
+    });
+
+    return index;
+}
+
+//------------------------------------------------------------------------------
+bool CoreString::Contains(const Rope &rope, std::string_view needle)
+{
+    return CoreString::Find(rope, needle) != std::string::npos;
+}
+
+//------------------------------------------------------------------------------
+size_t CoreString::Count(const Rope &rope, std::string_view needle)
+{
+    if(needle.empty())
+        return 0;
+
+    auto count = size_t(0);
+    ForEachMatch(rope, needle, 0, [&count](size_t) {
+        ++count;
+        return true;
+    });
+
+    return count;
+}
+
+//------------------------------------------------------------------------------
+CoreString::Rope CoreString::Replace(
+    const Rope       &rope,
+    std::string_view  what,
+    std::string_view  to)
+{
+    if(what.empty())
+        return rope;
+
+    auto result = Rope();
+    auto with   = Rope(to);
+    auto index  = size_t(0);
+
+    ForEachMatch(rope, what, 0, [&](size_t found) {
+        result.Append(rope.Substr(index, found - index));
+        result.Append(with);
+
+        index = found + what.size();
+        return true;
+    });
+
+    result.Append(rope.Substr(index));
+    return result;
+}
+
+//------------------------------------------------------------------------------
+std::vector<std::string> CoreString::Split(
+    const Rope       &rope,
+    std::string_view  chars)
+{
+    auto vec     = std::vector<std::string>();
+    auto current = std::string();
+
+    RopeChunkIterator it(rope);
+    std::string_view chunk;
+    while(it.Next(chunk))
+    {
+        auto index = size_t(0);
+        while(true)
+        {
+            auto found = chunk.find_first_of(chars, index);
+            if(found == std::string_view::npos)
+                break;
+
+            current.append(chunk.substr(index, found - index));
+            vec.push_back(std::move(current));
+            current.clear();
+
+            index = found + 1;
+        }
+
+        current.append(chunk.substr(index));
+    }
+
+    vec.push_back(std::move(current));
+    return vec;
+}
+
+//------------------------------------------------------------------------------
+std::vector<std::string> CoreString::Split(const Rope &rope, char c)
+{
+    return CoreString::Split(rope, std::string_view(&c, 1));
+}
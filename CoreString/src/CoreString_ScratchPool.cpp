@@ -0,0 +1,77 @@
+// Header
+#include "../include/CoreString_ScratchPool.h"
+// std
+#include <atomic>
+
+
+//------------------------------------------------------------------------------
+// Helper Functions.
+namespace {
+
+// Bounds of what each thread keeps.
+constexpr size_t kMaxBuffers  = 8;
+constexpr size_t kMaxCapacity = 64 * 1024;
+
+std::atomic<uint64_t> g_hits   (0);
+std::atomic<uint64_t> g_misses (0);
+std::atomic<uint64_t> g_dropped(0);
+
+// Only touched by its thread, so no locks.
+struct Pool
+{
+    std::string buffers[kMaxBuffers];
+    size_t      count = 0;
+};
+
+thread_local Pool t_pool;
+
+} // Anonymous namespace.
+
+
+//------------------------------------------------------------------------------
+void CoreString::Private_Scratch::Acquire(std::string &out) noexcept
+{
+    auto &pool = t_pool;
+    if(pool.count == 0)
+    {
+        g_misses.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    out = std::move(pool.buffers[--pool.count]);
+    out.clear();
+
+    g_hits.fetch_add(1, std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+void CoreString::Private_Scratch::Release(std::string &&buffer) noexcept
+{
+    auto &pool = t_pool;
+    if(pool.count == kMaxBuffers || buffer.capacity() > kMaxCapacity)
+    {
+        g_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    pool.buffers[pool.count++] = std::move(buffer);
+}
+
+
+//------------------------------------------------------------------------------
+CoreString::ScratchPoolStats CoreString::GetScratchPoolStats() noexcept
+{
+    return ScratchPoolStats{
+        g_hits   .load(std::memory_order_relaxed),
+        g_misses .load(std::memory_order_relaxed),
+        g_dropped.load(std::memory_order_relaxed)
+    };
+}
+
+//------------------------------------------------------------------------------
+void CoreString::ResetScratchPoolStats() noexcept
+{
+    g_hits   .store(0, std::memory_order_relaxed);
+    g_misses .store(0, std::memory_order_relaxed);
+    g_dropped.store(0, std::memory_order_relaxed);
+}
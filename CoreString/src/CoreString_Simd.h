@@ -0,0 +1,201 @@
+#pragma once
+//------------------------------------------------------------------------------
+// Private helpers shared by the vectorized kernels.
+//   Nothing here is part of the public interface, so this header lives
+//   with the sources and must not be included by the public headers.
+//
+//   The SSE2 paths are selected at compile time (SSE2 is part of every
+//   x86_64 target) and every kernel has a portable fallback that works
+//   8 bytes at time inside a uint64_t (SWAR) or one byte at time.
+
+// std
+#include <cstdint>
+#include <cstring>
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+// CoreString
+#include "../include/CoreString_Utils.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define CORESTRING_HAS_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define CORESTRING_HAS_SSE2 0
+#endif
+
+// The wider sets are only used when the build targets them
+// (e.g. -mssse3, -mavx2 or -march=native). MSVC has no macro
+// for SSSE3, but /arch:AVX2 implies it.
+#if defined(__AVX2__)
+    #define CORESTRING_HAS_AVX2 1
+    #include <immintrin.h>
+#else
+    #define CORESTRING_HAS_AVX2 0
+#endif
+
+#if defined(__SSSE3__) || CORESTRING_HAS_AVX2
+    #define CORESTRING_HAS_SSSE3 1
+    #include <tmmintrin.h>
+#else
+    #define CORESTRING_HAS_SSSE3 0
+#endif
+
+NS_CORESTRING_BEGIN
+namespace Private_Simd {
+
+//------------------------------------------------------------------------------
+// Constants.
+constexpr uint64_t kOnes  = 0x0101010101010101ULL;
+constexpr uint64_t kHighs = 0x8080808080808080ULL;
+
+//------------------------------------------------------------------------------
+// Loads.
+inline uint64_t LoadWord(const char *data) noexcept
+{
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+// Loads up to 8 bytes, the missing ones are zero.
+inline uint64_t LoadPartialWord(const char *data, size_t size) noexcept
+{
+    uint64_t word = 0;
+    std::memcpy(&word, data, size);
+    return word;
+}
+
+//------------------------------------------------------------------------------
+// Scalar.
+inline char FoldAscii(char c) noexcept
+{
+    return (c >= 'A' && c <= 'Z') ? char(c | 0x20) : c;
+}
+
+//------------------------------------------------------------------------------
+// SWAR.
+inline bool IsAsciiWord(uint64_t word) noexcept
+{
+    return (word & kHighs) == 0;
+}
+
+// High bit of each byte set where the byte is zero.
+//   Bytes after the first zero one might be flagged as well
+//   because of the borrow, so only the first flag is exact.
+inline uint64_t ZeroBytesMask(uint64_t word) noexcept
+{
+    return (word - kOnes) & ~word & kHighs;
+}
+
+// High bit of each byte set where the byte is c.
+inline uint64_t EqualBytesMask(uint64_t word, char c) noexcept
+{
+    return ZeroBytesMask(word ^ (kOnes * uint8_t(c)));
+}
+
+// Lowercases the ASCII letters of the 8 bytes, leaving the others alone.
+inline uint64_t FoldAsciiWord(uint64_t word) noexcept
+{
+    auto heptets  = word & ~kHighs;
+    auto is_ge_a  = heptets + kOnes * (0x80 - 'A');
+    auto is_gt_z  = heptets + kOnes * (0x7F - 'Z');
+    auto is_upper = (is_ge_a ^ is_gt_z) & ~word & kHighs;
+
+    return word | (is_upper >> 2);
+}
+
+// Index of the lowest set bit, mask must not be zero.
+inline size_t FirstSetBit64(uint64_t mask) noexcept
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, mask);
+    return size_t(index);
+#else
+    return size_t(__builtin_ctzll(mask));
+#endif
+}
+
+// Number of set bits.
+inline size_t PopCount(unsigned mask) noexcept
+{
+#if defined(_MSC_VER)
+    return size_t(__popcnt(mask));
+#else
+    return size_t(__builtin_popcount(mask));
+#endif
+}
+
+// Index of the first non zero byte of the mask, e.g. the ones built by
+// the functions above or the xor of two words to find where they differ.
+//   The words are loaded with memcpy, so this expects a little endian target.
+inline size_t FirstFlaggedByte(uint64_t mask) noexcept
+{
+    return FirstSetBit64(mask) / 8;
+}
+
+//------------------------------------------------------------------------------
+// SSE2.
+#if CORESTRING_HAS_SSE2
+inline __m128i Load16(const char *data) noexcept
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+}
+
+// Lowercases the ASCII letters of the 16 bytes, leaving the others alone.
+inline __m128i FoldAscii16(__m128i v) noexcept
+{
+    // Moves 'A'...'Z' to the bottom of the signed range,
+    // so a single signed compare finds all of them.
+    auto shifted  = _mm_add_epi8(v, _mm_set1_epi8(char(0x80 - 'A')));
+    auto is_upper = _mm_cmplt_epi8(shifted, _mm_set1_epi8(char(-128 + 26)));
+
+    return _mm_or_si128(v, _mm_and_si128(is_upper, _mm_set1_epi8(0x20)));
+}
+
+// 0xFF on the bytes in [lo, hi] - moved to the bottom of the
+// signed range, so a single signed compare checks both ends.
+inline __m128i InRange16(__m128i v, char lo, char hi) noexcept
+{
+    auto shifted = _mm_add_epi8(v, _mm_set1_epi8(char(0x80 - uint8_t(lo))));
+    return _mm_cmplt_epi8(shifted, _mm_set1_epi8(char(-128 + (hi - lo) + 1)));
+}
+
+inline __m128i Equal16(__m128i v, char c) noexcept
+{
+    return _mm_cmpeq_epi8(v, _mm_set1_epi8(c));
+}
+
+inline unsigned Mask16(__m128i v) noexcept
+{
+    return unsigned(_mm_movemask_epi8(v));
+}
+
+// Index of the lowest set bit, mask must not be zero.
+inline size_t FirstSetBit(unsigned mask) noexcept
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return size_t(index);
+#else
+    return size_t(__builtin_ctz(mask));
+#endif
+}
+
+// Index of the highest set bit, mask must not be zero.
+inline size_t LastSetBit(unsigned mask) noexcept
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse(&index, mask);
+    return size_t(index);
+#else
+    return size_t(31 - __builtin_clz(mask));
+#endif
+}
+#endif // CORESTRING_HAS_SSE2
+
+} // namespace Private_Simd
+NS_CORESTRING_END
@@ -0,0 +1,423 @@
+// Header
+#include "../include/CoreString_Sort.h"
+// std
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+// CoreString
+#include "../include/CoreString_CaseInsensitive.h"
+#include "CoreString_Simd.h"
+
+using namespace CoreString::Private_Simd;
+
+
+//------------------------------------------------------------------------------
+// Helper Functions.
+namespace {
+
+// Below these sizes the next algorithm does better.
+constexpr size_t kInsertionSortSize   = 16;
+constexpr size_t kRadixSortSize       = 1024;
+constexpr size_t kMinStringsPerThread = 16384;
+
+// A key for each of the 256 byte values plus the 0 for the end of the string.
+constexpr size_t kBucketsCount = 257;
+
+//------------------------------------------------------------------------------
+// Key of the char at depth - 0 if the string is over, so the shorter
+// strings come first.
+template <bool IgnoreCase>
+inline uint16_t KeyAt(std::string_view str, size_t depth) noexcept
+{
+    if(depth >= str.size())
+        return 0;
+
+    auto c = str[depth];
+    if constexpr(IgnoreCase)
+        c = FoldAscii(c);
+
+    return uint16_t(uint8_t(c) + 1);
+}
+
+// Compares the strings from depth on - the chars before are equal.
+template <bool IgnoreCase>
+inline bool LessFrom(std::string_view lhs, std::string_view rhs, size_t depth) noexcept
+{
+    lhs.remove_prefix(depth);
+    rhs.remove_prefix(depth);
+
+    if constexpr(IgnoreCase)
+        return CoreString::CompareIgnoreCase(lhs, rhs) < 0;
+    else
+        return lhs < rhs;
+}
+
+template <typename T, bool IgnoreCase>
+void InsertionSort(T *a, size_t size, size_t depth)
+{
+    for(auto i = size_t(1); i < size; ++i)
+    {
+        auto j = i;
+        if(!LessFrom<IgnoreCase>(a[j], a[j - 1], depth))
+            continue;
+
+        auto value = std::move(a[i]);
+        do {
+            a[j] = std::move(a[j - 1]);
+            --j;
+        } while(j != 0 && LessFrom<IgnoreCase>(value, a[j - 1], depth));
+
+        a[j] = std::move(value);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Bentley & Sedgewick's multikey quicksort: a 3-way partition on the
+// char at depth, the equal part goes on to the next char.
+template <typename T, bool IgnoreCase>
+void MultikeyQuicksort(T *a, size_t size, size_t depth)
+{
+    while(size > kInsertionSortSize)
+    {
+        auto k0    = KeyAt<IgnoreCase>(a[0],        depth);
+        auto k1    = KeyAt<IgnoreCase>(a[size / 2], depth);
+        auto k2    = KeyAt<IgnoreCase>(a[size - 1], depth);
+        auto pivot = std::max(std::min(k0, k1), std::min(std::max(k0, k1), k2));
+
+        auto lt = size_t(0);
+        auto gt = size;
+        for(auto i = size_t(0); i < gt; )
+        {
+            auto key = KeyAt<IgnoreCase>(a[i], depth);
+            if(key < pivot)
+                std::swap(a[lt++], a[i++]);
+            else if(key > pivot)
+                std::swap(a[i], a[--gt]);
+            else
+                ++i;
+        }
+
+        MultikeyQuicksort<T, IgnoreCase>(a,      lt,        depth);
+        MultikeyQuicksort<T, IgnoreCase>(a + gt, size - gt, depth);
+
+        // The equal ones are over, so they're all the same.
+        if(pivot == 0)
+            return;
+
+        a    += lt;
+        size  = gt - lt;
+        ++depth;
+    }
+
+    InsertionSort<T, IgnoreCase>(a, size, depth);
+}
+
+//------------------------------------------------------------------------------
+// MSD radix sort (in place, as the American flag sort). The keys are read
+// once into the oracle, that is permuted along with the strings.
+struct Buckets
+{
+    size_t depth;
+    size_t starts[kBucketsCount];
+    size_t counts[kBucketsCount];
+};
+
+// Splits the strings by their first different char, returning the
+// buckets (and the depth of that char). If all the strings are equal
+// they all end up in the bucket 0.
+template <typename T, bool IgnoreCase>
+void Distribute(T *a, uint16_t *oracle, size_t size, size_t depth, Buckets &buckets)
+{
+    auto &counts = buckets.counts;
+    while(true)
+    {
+        std::fill(std::begin(counts), std::end(counts), size_t(0));
+        for(auto i = size_t(0); i < size; ++i)
+        {
+            oracle[i] = KeyAt<IgnoreCase>(a[i], depth);
+            ++counts[oracle[i]];
+        }
+
+        // A common char, no need to move anything.
+        if(counts[oracle[0]] != size || oracle[0] == 0)
+            break;
+        ++depth;
+    }
+    buckets.depth = depth;
+
+    size_t next[kBucketsCount];
+    for(auto b = size_t(0), start = size_t(0); b < kBucketsCount; ++b)
+    {
+        buckets.starts[b] = next[b] = start;
+        start += counts[b];
+    }
+
+    for(auto b = size_t(0); b < kBucketsCount; ++b)
+    {
+        auto end = buckets.starts[b] + counts[b];
+        while(next[b] < end)
+        {
+            auto i = next[b];
+            auto c = oracle[i];
+            if(c == b)
+            {
+                ++next[b];
+                continue;
+            }
+
+            auto j = next[c]++;
+            std::swap(a[i],      a[j]);
+            std::swap(oracle[i], oracle[j]);
+        }
+    }
+}
+
+template <typename T, bool IgnoreCase>
+void SortBucket(T *a, uint16_t *oracle, size_t size, size_t depth);
+
+template <typename T, bool IgnoreCase>
+void RadixSort(T *a, uint16_t *oracle, size_t size, size_t depth)
+{
+    auto buckets = Buckets{};
+    Distribute<T, IgnoreCase>(a, oracle, size, depth, buckets);
+
+    // The bucket 0 has the strings that are over - all equal.
+    for(auto b = size_t(1); b < kBucketsCount; ++b)
+    {
+        auto start = buckets.starts[b];
+        SortBucket<T, IgnoreCase>(a + start, oracle + start, buckets.counts[b], buckets.depth + 1);
+    }
+}
+
+template <typename T, bool IgnoreCase>
+void SortBucket(T *a, uint16_t *oracle, size_t size, size_t depth)
+{
+    if(size < 2)
+        return;
+
+    if(size < kRadixSortSize)
+        MultikeyQuicksort<T, IgnoreCase>(a, size, depth);
+    else
+        RadixSort<T, IgnoreCase>(a, oracle, size, depth);
+}
+
+//------------------------------------------------------------------------------
+// The first split is made by the calling thread and the buckets, the
+// biggest first, are given to the threads as they get free.
+template <typename T, bool IgnoreCase>
+void Sort(T *first, T *last, size_t threadsCount)
+{
+    auto size = size_t(last - first);
+    if(size < kRadixSortSize)
+    {
+        MultikeyQuicksort<T, IgnoreCase>(first, size, 0);
+        return;
+    }
+
+    if(threadsCount == 0)
+        threadsCount = std::max(1U, std::thread::hardware_concurrency());
+
+    threadsCount = std::max(size_t(1), std::min(threadsCount, size / kMinStringsPerThread));
+
+    auto oracle = std::vector<uint16_t>(size);
+    if(threadsCount == 1)
+    {
+        RadixSort<T, IgnoreCase>(first, oracle.data(), size, 0);
+        return;
+    }
+
+    auto buckets = Buckets{};
+    Distribute<T, IgnoreCase>(first, oracle.data(), size, 0, buckets);
+
+    auto order = std::vector<size_t>();
+    for(auto b = size_t(1); b < kBucketsCount; ++b)
+    {
+        if(buckets.counts[b] > 1)
+            order.push_back(b);
+    }
+    std::sort(std::begin(order), std::end(order), [&](size_t lhs, size_t rhs) {
+        return buckets.counts[lhs] > buckets.counts[rhs];
+    });
+
+    auto next_task = std::atomic<size_t>(0);
+    auto sort_buckets = [&]() {
+        for(auto task = next_task++; task < order.size(); task = next_task++)
+        {
+            auto b     = order[task];
+            auto start = buckets.starts[b];
+            SortBucket<T, IgnoreCase>(
+                first         + start,
+                oracle.data() + start,
+                buckets.counts[b],
+                buckets.depth + 1
+            );
+        }
+    };
+
+    threadsCount = std::min(threadsCount, order.size());
+
+    auto threads = std::vector<std::thread>();
+    for(auto t = size_t(1); t < threadsCount; ++t)
+        threads.emplace_back(sort_buckets);
+
+    sort_buckets();
+    for(auto &thread : threads)
+        thread.join();
+}
+
+
+//------------------------------------------------------------------------------
+// Natural order.
+inline bool IsDigit(char c) noexcept
+{
+    return c >= '0' && c <= '9';
+}
+
+template <bool IgnoreCase>
+int NaturalCompareImpl(std::string_view lhs, std::string_view rhs) noexcept
+{
+    // The numbers with the same value but different leading zeros
+    // only decide when nothing else does.
+    auto zeros_order = 0;
+
+    auto i = size_t(0);
+    auto j = size_t(0);
+    while(i < lhs.size() && j < rhs.size())
+    {
+        if(!IsDigit(lhs[i]) || !IsDigit(rhs[j]))
+        {
+            auto a = lhs[i++];
+            auto b = rhs[j++];
+            if constexpr(IgnoreCase)
+            {
+                a = FoldAscii(a);
+                b = FoldAscii(b);
+            }
+
+            if(a != b)
+                return int(uint8_t(a)) - int(uint8_t(b));
+            continue;
+        }
+
+        // Both are at a number: skips the leading zeros, then the one
+        // with more digits is bigger and the same sized are compared
+        // digit by digit.
+        auto lhs_zeros = i;
+        auto rhs_zeros = j;
+        while(i < lhs.size() && lhs[i] == '0') ++i;
+        while(j < rhs.size() && rhs[j] == '0') ++j;
+
+        auto lhs_digits = i;
+        auto rhs_digits = j;
+        while(i < lhs.size() && IsDigit(lhs[i])) ++i;
+        while(j < rhs.size() && IsDigit(rhs[j])) ++j;
+
+        auto lhs_size = i - lhs_digits;
+        auto rhs_size = j - rhs_digits;
+        if(lhs_size != rhs_size)
+            return (lhs_size < rhs_size) ? -1 : 1;
+
+        auto cmp = std::memcmp(lhs.data() + lhs_digits, rhs.data() + rhs_digits, lhs_size);
+        if(cmp != 0)
+            return cmp;
+
+        lhs_zeros = lhs_digits - lhs_zeros;
+        rhs_zeros = rhs_digits - rhs_zeros;
+        if(zeros_order == 0 && lhs_zeros != rhs_zeros)
+            zeros_order = (lhs_zeros < rhs_zeros) ? -1 : 1;
+    }
+
+    if(i < lhs.size()) return  1;
+    if(j < rhs.size()) return -1;
+
+    return zeros_order;
+}
+
+} // Anonymous namespace.
+
+
+//------------------------------------------------------------------------------
+void CoreString::SortStrings(
+    std::string *first,
+    std::string *last,
+    size_t       threadsCount /* = 0 */)
+{
+    Sort<std::string, false>(first, last, threadsCount);
+}
+
+//------------------------------------------------------------------------------
+void CoreString::SortStrings(
+    std::string_view *first,
+    std::string_view *last,
+    size_t            threadsCount /* = 0 */)
+{
+    Sort<std::string_view, false>(first, last, threadsCount);
+}
+
+//------------------------------------------------------------------------------
+void CoreString::SortStrings(
+    std::vector<std::string> &strings,
+    size_t                    threadsCount /* = 0 */)
+{
+    SortStrings(strings.data(), strings.data() + strings.size(), threadsCount);
+}
+
+//------------------------------------------------------------------------------
+void CoreString::SortStrings(
+    std::vector<std::string_view> &strings,
+    size_t                         threadsCount /* = 0 */)
+{
+    SortStrings(strings.data(), strings.data() + strings.size(), threadsCount);
+}
+
+
+//------------------------------------------------------------------------------
+void CoreString::SortStringsIgnoreCase(
+    std::string *first,
+    std::string *last,
+    size_t       threadsCount /* = 0 */)
+{
+    Sort<std::string, true>(first, last, threadsCount);
+}
+
+//------------------------------------------------------------------------------
+void CoreString::SortStringsIgnoreCase(
+    std::string_view *first,
+    std::string_view *last,
+    size_t            threadsCount /* = 0 */)
+{
+    Sort<std::string_view, true>(first, last, threadsCount);
+}
+
+//------------------------------------------------------------------------------
+void CoreString::SortStringsIgnoreCase(
+    std::vector<std::string> &strings,
+    size_t                    threadsCount /* = 0 */)
+{
+    SortStringsIgnoreCase(strings.data(), strings.data() + strings.size(), threadsCount);
+}
+
+//------------------------------------------------------------------------------
+void CoreString::SortStringsIgnoreCase(
+    std::vector<std::string_view> &strings,
+    size_t                         threadsCount /* = 0 */)
+{
+    SortStringsIgnoreCase(strings.data(), strings.data() + strings.size(), threadsCount);
+}
+
+
+//------------------------------------------------------------------------------
+int CoreString::NaturalCompare(std::string_view lhs, std::string_view rhs) noexcept
+{
+    return NaturalCompareImpl<false>(lhs, rhs);
+}
+
+//------------------------------------------------------------------------------
+int CoreString::NaturalCompareIgnoreCase(
+    std::string_view lhs,
+    std::string_view rhs) noexcept
+{
+    return NaturalCompareImpl<true>(lhs, rhs);
+}
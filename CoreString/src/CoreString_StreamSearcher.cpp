@@ -0,0 +1,223 @@
+// Header
+#include "../include/CoreString_StreamSearcher.h"
+// std
+#include <algorithm>
+#include <limits>
+// CoreAssert
+#include "CoreAssert/CoreAssert.h"
+
+
+//------------------------------------------------------------------------------
+// Helper Functions.
+namespace {
+
+constexpr uint32_t kNoState = std::numeric_limits<uint32_t>::max();
+
+} // Anonymous namespace.
+
+
+//------------------------------------------------------------------------------
+CoreString::StreamSearcher::StreamSearcher(std::string_view needle) :
+    m_position    (0),
+    m_needle      (needle),
+    m_classes     {},
+    m_classesCount(0),
+    m_state       (0)
+{
+    if(!m_needle.empty())
+        m_carry.reserve(m_needle.size() - 1);
+}
+
+//------------------------------------------------------------------------------
+CoreString::StreamSearcher::StreamSearcher(const std::vector<std::string> &needles) :
+    m_position    (0),
+    m_classes     {},
+    m_classesCount(1),
+    m_state       (0)
+{
+    //--------------------------------------------------------------------------
+    // The bytes that aren't on any needle share the class 0, so the rows
+    // of the table are only as wide as the needles' alphabet.
+    auto total_size = size_t(0);
+    for(const auto &needle : needles)
+    {
+        total_size += needle.size();
+        for(auto c : needle)
+        {
+            auto &byte_class = m_classes[uint8_t(c)];
+            if(byte_class == 0)
+                byte_class = uint16_t(m_classesCount++);
+        }
+    }
+
+    COREASSERT_ASSERT(
+        total_size < kNoState,
+        "StreamSearcher can't have needles with more than 2^32 bytes in total"
+    );
+
+    //--------------------------------------------------------------------------
+    // Trie of the needles.
+    auto outputs = std::vector<std::vector<uint32_t>>(1);
+    m_transitions.assign(m_classesCount, kNoState);
+
+    m_needlesSizes.reserve(needles.size());
+    for(auto i = size_t(0); i < needles.size(); ++i)
+    {
+        m_needlesSizes.push_back(needles[i].size());
+        if(needles[i].empty())
+            continue;
+
+        auto state = uint32_t(0);
+        for(auto c : needles[i])
+        {
+            auto &next = m_transitions[state * m_classesCount + m_classes[uint8_t(c)]];
+            if(next == kNoState)
+            {
+                next = uint32_t(outputs.size());
+                outputs.emplace_back();
+                m_transitions.resize(m_transitions.size() + m_classesCount, kNoState);
+            }
+            state = m_transitions[state * m_classesCount + m_classes[uint8_t(c)]];
+        }
+        outputs[state].push_back(uint32_t(i));
+    }
+
+    //--------------------------------------------------------------------------
+    // Breadth first, each state's failure (the longest suffix of it that
+    // is on the trie) is already complete when its children are reached -
+    // so the missing transitions are taken from it, making a DFA, and its
+    // outputs are added to the ones of the state.
+    auto failures = std::vector<uint32_t>(outputs.size(), 0);
+    auto queue    = std::vector<uint32_t>{ 0 };
+    for(auto i = size_t(0); i < queue.size(); ++i)
+    {
+        auto state = queue[i];
+        auto row   = state * m_classesCount;
+        auto fail  = failures[state] * m_classesCount;
+
+        for(auto c = size_t(0); c < m_classesCount; ++c)
+        {
+            auto &next = m_transitions[row + c];
+            if(next == kNoState)
+            {
+                next = (state == 0) ? 0 : m_transitions[fail + c];
+                continue;
+            }
+
+            failures[next] = (state == 0) ? 0 : m_transitions[fail + c];
+
+            auto &inherited = outputs[failures[next]];
+            outputs[next].insert(std::end(outputs[next]), std::begin(inherited), std::end(inherited));
+            queue.push_back(next);
+        }
+    }
+
+    m_outputsOffsets.reserve(outputs.size() + 1);
+    for(const auto &state_outputs : outputs)
+    {
+        m_outputsOffsets.push_back(uint32_t(m_outputs.size()));
+        m_outputs.insert(std::end(m_outputs), std::begin(state_outputs), std::end(state_outputs));
+    }
+    m_outputsOffsets.push_back(uint32_t(m_outputs.size()));
+}
+
+
+//------------------------------------------------------------------------------
+void CoreString::StreamSearcher::Feed(
+    std::string_view    chunk,
+    std::vector<Match> &matches)
+{
+    // Only the many needles' constructor makes the automaton.
+    if(m_transitions.empty())
+        FeedSingle(chunk, matches);
+    else
+        FeedAutomaton(chunk, matches);
+
+    m_position += chunk.size();
+}
+
+//------------------------------------------------------------------------------
+void CoreString::StreamSearcher::Reset() noexcept
+{
+    m_position = 0;
+    m_state    = 0;
+    m_carry.clear();
+}
+
+
+//------------------------------------------------------------------------------
+void CoreString::StreamSearcher::FeedSingle(
+    std::string_view    chunk,
+    std::vector<Match> &matches)
+{
+    if(m_needle.empty())
+        return;
+
+    auto overlap = m_needle.size() - 1;
+
+    //--------------------------------------------------------------------------
+    // Matches that start on the carry - they're searched on the carry
+    // followed by the start of the chunk, the others are on the chunk.
+    if(!m_carry.empty())
+    {
+        m_boundary.assign(m_carry);
+        m_boundary.append(chunk.substr(0, overlap));
+
+        auto carry_begin = m_position - m_carry.size();
+        for(auto index = m_boundary.find(m_needle);
+            index < m_carry.size();
+            index = m_boundary.find(m_needle, index + 1))
+        {
+            matches.push_back(Match{ carry_begin + index, 0 });
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Matches inside the chunk.
+    for(auto index = chunk.find(m_needle);
+        index != std::string_view::npos;
+        index = chunk.find(m_needle, index + 1))
+    {
+        matches.push_back(Match{ m_position + index, 0 });
+    }
+
+    //--------------------------------------------------------------------------
+    // Keeps the last bytes - of the carry too if the chunk is smaller.
+    if(chunk.size() >= overlap)
+    {
+        m_carry.assign(chunk.substr(chunk.size() - overlap));
+    }
+    else
+    {
+        m_carry.append(chunk);
+        if(m_carry.size() > overlap)
+            m_carry.erase(0, m_carry.size() - overlap);
+    }
+}
+
+//------------------------------------------------------------------------------
+void CoreString::StreamSearcher::FeedAutomaton(
+    std::string_view    chunk,
+    std::vector<Match> &matches)
+{
+    auto transitions = m_transitions.data();
+    auto offsets     = m_outputsOffsets.data();
+    auto state       = m_state;
+
+    for(auto i = size_t(0); i < chunk.size(); ++i)
+    {
+        state = transitions[state * m_classesCount + m_classes[uint8_t(chunk[i])]];
+        if(offsets[state] == offsets[state + 1])
+            continue;
+
+        // The needles end at i.
+        auto end = m_position + i + 1;
+        for(auto o = offsets[state]; o < offsets[state + 1]; ++o)
+        {
+            auto needle = m_outputs[o];
+            matches.push_back(Match{ end - m_needlesSizes[needle], needle });
+        }
+    }
+
+    m_state = state;
+}
@@ -0,0 +1,54 @@
+// Header
+#include "../include/CoreString_StringTable.h"
+
+
+//------------------------------------------------------------------------------
+// Helper Functions.
+namespace {
+
+// Appends the components of str, separated by what find finds.
+//   Nothing is reserved up front - an exact reserve on every call would
+//   undo the geometric growth of Append when many small strings are
+//   split into the same table.
+template <typename FindFunc>
+void SplitInto(CoreString::StringTable &table, std::string_view str, FindFunc find)
+{
+    auto index = size_t(0);
+    while(true)
+    {
+        auto found = find(index);
+        if(found == std::string_view::npos)
+            break;
+
+        table.Append(str.substr(index, found - index));
+        index = found + 1;
+    }
+
+    table.Append(str.substr(index));
+}
+
+} // Anonymous namespace.
+
+
+//------------------------------------------------------------------------------
+void CoreString::Split(
+    std::string_view  str,
+    std::string_view  chars,
+    StringTable      &table)
+{
+    SplitInto(table, str, [&](size_t index) {
+        return str.find_first_of(chars, index);
+    });
+}
+
+//------------------------------------------------------------------------------
+void CoreString::Split(
+    std::string_view  str,
+    char              c,
+    StringTable      &table)
+{
+    // A single char goes through memchr.
+    SplitInto(table, str, [&](size_t index) {
+        return str.find(c, index);
+    });
+}
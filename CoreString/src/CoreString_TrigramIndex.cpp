@@ -0,0 +1,242 @@
+// Header
+#include "../include/CoreString_TrigramIndex.h"
+// std
+#include <algorithm>
+#include <limits>
+#include <thread>
+// CoreString
+#include "../include/CoreString_EditDistance.h"
+// CoreAssert
+#include "CoreAssert/CoreAssert.h"
+
+
+//------------------------------------------------------------------------------
+// Helper Functions.
+namespace {
+
+// Below that a thread costs more than what it does.
+constexpr size_t kMinStringsPerThread = 4096;
+
+//------------------------------------------------------------------------------
+// Calls func with the key of each trigram of str, padded with two
+// zeros at the start and one at the end - str.size() + 1 trigrams.
+template <typename Func>
+void ForEachTrigram(std::string_view str, Func func)
+{
+    auto key = uint32_t(0);
+    for(auto c : str)
+    {
+        key = ((key << 8) | uint8_t(c)) & 0xFFFFFF;
+        func(key);
+    }
+
+    func((key << 8) & 0xFFFFFF);
+}
+
+//------------------------------------------------------------------------------
+inline void WriteVarint(std::vector<uint8_t> &out, uint32_t value)
+{
+    while(value >= 0x80)
+    {
+        out.push_back(uint8_t(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(uint8_t(value));
+}
+
+//------------------------------------------------------------------------------
+inline uint32_t ReadVarint(const uint8_t *&data) noexcept
+{
+    auto value = uint32_t(0);
+    auto shift = 0;
+    while(*data & 0x80)
+    {
+        value |= uint32_t(*data++ & 0x7F) << shift;
+        shift += 7;
+    }
+
+    return value | (uint32_t(*data++) << shift);
+}
+
+} // Anonymous namespace.
+
+
+//------------------------------------------------------------------------------
+CoreString::TrigramIndex::TrigramIndex(
+    const std::vector<std::string> &strings,
+    size_t                          threadsCount /* = 0 */)
+{
+    COREASSERT_ASSERT(
+        strings.size() < std::numeric_limits<uint32_t>::max(),
+        "TrigramIndex can't hold more than 2^32 strings"
+    );
+
+    //--------------------------------------------------------------------------
+    // All the strings in a single buffer.
+    auto total_size = size_t(0);
+    for(const auto &str : strings)
+        total_size += str.size();
+
+    m_data.reserve(total_size);
+    m_offsets.reserve(strings.size() + 1);
+    for(const auto &str : strings)
+    {
+        m_offsets.push_back(m_data.size());
+        m_data.append(str);
+    }
+    m_offsets.push_back(m_data.size());
+
+    //--------------------------------------------------------------------------
+    // Each thread takes a contiguous range of the strings and makes the
+    // sorted (trigram << 32 | index) pairs of it - so the ranges are
+    // already in the order of the indexes when they're merged.
+    if(threadsCount == 0)
+        threadsCount = std::max(1U, std::thread::hardware_concurrency());
+
+    auto max_threads = (strings.size() + kMinStringsPerThread - 1) / kMinStringsPerThread;
+    threadsCount = std::max(size_t(1), std::min(threadsCount, max_threads));
+
+    auto per_thread = (strings.size() + threadsCount - 1) / threadsCount;
+    auto pairs      = std::vector<std::vector<uint64_t>>(threadsCount);
+
+    auto build_range = [&](size_t thread) {
+        auto begin = std::min(strings.size(), thread * per_thread);
+        auto end   = std::min(strings.size(), begin + per_thread);
+        auto &out  = pairs[thread];
+
+        for(auto i = begin; i < end; ++i)
+        {
+            out.reserve(out.size() + strings[i].size() + 1);
+            ForEachTrigram(strings[i], [&](uint32_t key) {
+                out.push_back((uint64_t(key) << 32) | i);
+            });
+        }
+
+        std::sort(std::begin(out), std::end(out));
+        out.erase(std::unique(std::begin(out), std::end(out)), std::end(out));
+    };
+
+    auto threads = std::vector<std::thread>();
+    for(auto t = size_t(1); t < threadsCount; ++t)
+        threads.emplace_back(build_range, t);
+
+    build_range(0);
+    for(auto &thread : threads)
+        thread.join();
+
+    //--------------------------------------------------------------------------
+    // Merges the ranges, one trigram at time, delta encoding the indexes.
+    auto cursors = std::vector<size_t>(threadsCount, 0);
+    while(true)
+    {
+        auto key = std::numeric_limits<uint64_t>::max();
+        for(auto t = size_t(0); t < threadsCount; ++t)
+        {
+            if(cursors[t] < pairs[t].size())
+                key = std::min(key, pairs[t][cursors[t]] >> 32);
+        }
+
+        if(key == std::numeric_limits<uint64_t>::max())
+            break;
+
+        m_keys.push_back(uint32_t(key));
+        m_postingsOffsets.push_back(m_postings.size());
+
+        auto previous = uint32_t(0);
+        for(auto t = size_t(0); t < threadsCount; ++t)
+        {
+            auto &range  = pairs[t];
+            auto &cursor = cursors[t];
+            for(; cursor < range.size() && (range[cursor] >> 32) == key; ++cursor)
+            {
+                auto index = uint32_t(range[cursor]);
+                WriteVarint(m_postings, index - previous);
+                previous = index;
+            }
+        }
+    }
+    m_postingsOffsets.push_back(m_postings.size());
+}
+
+
+//------------------------------------------------------------------------------
+std::vector<CoreString::TrigramIndex::Match> CoreString::TrigramIndex::Find(
+    std::string_view query,
+    size_t           maxDistance) const
+{
+    auto matches = std::vector<Match>();
+    auto verify  = [&](size_t index) {
+        auto str = (*this)[index];
+
+        auto longest = std::max(str.size(), query.size());
+        if(longest - std::min(str.size(), query.size()) > maxDistance)
+            return;
+
+        auto distance = EditDistance(query, str, maxDistance);
+        if(distance <= maxDistance)
+            matches.push_back(Match{index, distance});
+    };
+
+    //--------------------------------------------------------------------------
+    // Count filter: each edit touches at most 3 trigrams, so a match must
+    // have at least (distinct - 3 * maxDistance) of the query's trigrams.
+    auto keys = std::vector<uint32_t>();
+    keys.reserve(query.size() + 1);
+    ForEachTrigram(query, [&](uint32_t key) { keys.push_back(key); });
+
+    std::sort(std::begin(keys), std::end(keys));
+    keys.erase(std::unique(std::begin(keys), std::end(keys)), std::end(keys));
+
+    auto required = (maxDistance < keys.size() && 3 * maxDistance < keys.size())
+        ? keys.size() - 3 * maxDistance
+        : 0;
+
+    if(required == 0)
+    {
+        // Nothing to filter with - only the lengths.
+        for(auto i = size_t(0); i < Size(); ++i)
+            verify(i);
+    }
+    else
+    {
+        // Reused between the calls, touched keeps what must be zeroed back.
+        thread_local std::vector<uint32_t> s_counts;
+        thread_local std::vector<uint32_t> s_touched;
+
+        if(s_counts.size() < Size())
+            s_counts.resize(Size(), 0);
+
+        s_touched.clear();
+        for(auto key : keys)
+        {
+            auto it = std::lower_bound(std::begin(m_keys), std::end(m_keys), key);
+            if(it == std::end(m_keys) || *it != key)
+                continue;
+
+            auto k     = size_t(it - std::begin(m_keys));
+            auto data  = m_postings.data() + m_postingsOffsets[k];
+            auto end   = m_postings.data() + m_postingsOffsets[k + 1];
+            auto index = uint32_t(0);
+            while(data < end)
+            {
+                index += ReadVarint(data);
+                if(s_counts[index]++ == 0)
+                    s_touched.push_back(index);
+            }
+        }
+
+        for(auto index : s_touched)
+        {
+            if(s_counts[index] >= required)
+                verify(index);
+
+            s_counts[index] = 0;
+        }
+    }
+
+    std::sort(std::begin(matches), std::end(matches), [](const Match &a, const Match &b) {
+        return (a.distance != b.distance) ? a.distance < b.distance : a.index < b.index;
+    });
+
+    return matches;
+}
@@ -0,0 +1,274 @@
+// Header
+#include "../include/CoreString_WhiteSpace.h"
+// std
+#include <cstdint>
+// CoreString
+#include "CoreString_Simd.h"
+
+using namespace CoreString::Private_Simd;
+using CoreString::WhiteSpaceClass;
+
+
+//------------------------------------------------------------------------------
+// Helper Functions.
+namespace {
+
+// Size of the (non ASCII) Unicode white-space at p, 0 if there's none.
+size_t UnicodeSpaceSize(const uint8_t *p, const uint8_t *end) noexcept
+{
+    auto size = end - p;
+    if(p[0] == 0xC2)                                  // U+0085 and U+00A0.
+        return (size >= 2 && (p[1] == 0x85 || p[1] == 0xA0)) ? 2 : 0;
+    if(size < 3)
+        return 0;
+
+    if(p[0] == 0xE1)                                  // U+1680.
+        return (p[1] == 0x9A && p[2] == 0x80) ? 3 : 0;
+    if(p[0] == 0xE3)                                  // U+3000.
+        return (p[1] == 0x80 && p[2] == 0x80) ? 3 : 0;
+    if(p[0] != 0xE2)
+        return 0;
+
+    if(p[1] == 0x80)                                  // U+2000...U+200A,
+    {                                                 // U+2028, U+2029
+        return ((p[2] >= 0x80 && p[2] <= 0x8A) ||     // and U+202F.
+                p[2] == 0xA8 || p[2] == 0xA9 || p[2] == 0xAF) ? 3 : 0;
+    }
+    return (p[1] == 0x81 && p[2] == 0x9F) ? 3 : 0;    // U+205F.
+}
+
+// Size of the white-space at p, 0 if there's none.
+template <bool Unicode>
+inline size_t SpaceSize(const uint8_t *p, const uint8_t *end) noexcept
+{
+    if(CoreString::IsWhiteSpace(char(*p)))
+        return 1;
+    if constexpr(Unicode)
+        return (*p >= 0x80) ? UnicodeSpaceSize(p, end) : 0;
+
+    return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// Bit i set if the byte i is an ASCII white-space.
+#if CORESTRING_HAS_SSE2
+inline unsigned SpaceMask16(__m128i v) noexcept
+{
+    return Mask16(_mm_or_si128(Equal16(v, ' '), InRange16(v, '\t', '\r')));
+}
+#endif // CORESTRING_HAS_SSE2
+
+// First white-space at or after p (or end).
+//   The blocks are checked for bytes that might start one - with the
+//   Unicode class that is any non ASCII byte too, checked one by one.
+template <bool Unicode>
+const uint8_t* FindSpace(const uint8_t *p, const uint8_t *end) noexcept
+{
+    while(p != end)
+    {
+    #if CORESTRING_HAS_SSE2
+        if(end - p >= 16)
+        {
+            auto v    = Load16(reinterpret_cast<const char *>(p));
+            auto mask = SpaceMask16(v);
+            if constexpr(Unicode)
+                mask |= Mask16(v);
+
+            if(mask == 0)
+            {
+                p += 16;
+                continue;
+            }
+            p += FirstSetBit(mask);
+        }
+    #endif // CORESTRING_HAS_SSE2
+
+        if(SpaceSize<Unicode>(p, end) != 0)
+            return p;
+        ++p;
+    }
+
+    return end;
+}
+
+// Past the run of white-spaces that starts at p, counting its line feeds.
+template <bool Unicode>
+const uint8_t* SkipSpaces(
+    const uint8_t *p,
+    const uint8_t *end,
+    size_t        &lineFeeds) noexcept
+{
+    while(p != end)
+    {
+    #if CORESTRING_HAS_SSE2
+        // Long runs (e.g. indentation) are skipped whole blocks at time.
+        if(end - p >= 16)
+        {
+            auto v = Load16(reinterpret_cast<const char *>(p));
+            if(SpaceMask16(v) == 0xFFFF)
+            {
+                lineFeeds += PopCount(Mask16(Equal16(v, '\n')));
+                p += 16;
+                continue;
+            }
+        }
+    #endif // CORESTRING_HAS_SSE2
+
+        auto size = SpaceSize<Unicode>(p, end);
+        if(size == 0)
+            break;
+
+        lineFeeds += (*p == '\n');
+        p += size;
+    }
+
+    return p;
+}
+
+// Start of the run of white-spaces that ends at end (end if there's none).
+template <bool Unicode>
+const uint8_t* SkipSpacesBack(const uint8_t *begin, const uint8_t *end) noexcept
+{
+    while(end != begin)
+    {
+    #if CORESTRING_HAS_SSE2
+        if(end - begin >= 16 &&
+           SpaceMask16(Load16(reinterpret_cast<const char *>(end - 16))) == 0xFFFF)
+        {
+            end -= 16;
+            continue;
+        }
+    #endif // CORESTRING_HAS_SSE2
+
+        if(CoreString::IsWhiteSpace(char(end[-1])))
+        {
+            --end;
+            continue;
+        }
+        if(!Unicode || end[-1] < 0x80)
+            break;
+
+        // Back to the lead byte of the sequence - they have at most 3.
+        auto start = end - 1;
+        while(start != begin && end - start < 3 && (*start & 0xC0) == 0x80)
+            --start;
+
+        if(UnicodeSpaceSize(start, end) != size_t(end - start))
+            break;
+        end = start;
+    }
+
+    return end;
+}
+
+template <bool Unicode>
+void Normalize(
+    std::string   &out,
+    const uint8_t *p,
+    const uint8_t *end,
+    bool           keepNewLines)
+{
+    auto line_feeds = size_t(0);
+    p   = SkipSpaces    <Unicode>(p, end, line_feeds);
+    end = SkipSpacesBack<Unicode>(p, end);
+
+    // The result is never longer than the trimmed string.
+    out.reserve(out.size() + size_t(end - p));
+    while(true)
+    {
+        auto space = FindSpace<Unicode>(p, end);
+        out.append(reinterpret_cast<const char *>(p), size_t(space - p));
+        if(space == end)
+            break;
+
+        line_feeds = 0;
+        p = SkipSpaces<Unicode>(space, end, line_feeds);
+
+        if(keepNewLines && line_feeds != 0)
+            out.append(line_feeds, '\n');
+        else
+            out.push_back(' ');
+    }
+}
+
+inline const uint8_t* Bytes(std::string_view str) noexcept
+{
+    return reinterpret_cast<const uint8_t *>(str.data());
+}
+
+} // Anonymous namespace.
+
+
+//------------------------------------------------------------------------------
+size_t CoreString::FindFirstNotWhiteSpace(
+    std::string_view str,
+    WhiteSpaceClass  whiteSpaceClass /* = WhiteSpaceClass::Ascii */) noexcept
+{
+    auto begin      = Bytes(str);
+    auto end        = begin + str.size();
+    auto line_feeds = size_t(0);
+
+    auto first = (whiteSpaceClass == WhiteSpaceClass::Unicode)
+        ? SkipSpaces<true >(begin, end, line_feeds)
+        : SkipSpaces<false>(begin, end, line_feeds);
+
+    return (first == end) ? std::string_view::npos : size_t(first - begin);
+}
+
+//------------------------------------------------------------------------------
+size_t CoreString::FindLastNotWhiteSpace(
+    std::string_view str,
+    WhiteSpaceClass  whiteSpaceClass /* = WhiteSpaceClass::Ascii */) noexcept
+{
+    auto begin = Bytes(str);
+    auto end   = begin + str.size();
+
+    auto last = (whiteSpaceClass == WhiteSpaceClass::Unicode)
+        ? SkipSpacesBack<true >(begin, end)
+        : SkipSpacesBack<false>(begin, end);
+
+    return (last == begin) ? std::string_view::npos : size_t(last - begin - 1);
+}
+
+//------------------------------------------------------------------------------
+std::string_view CoreString::TrimWhiteSpace(
+    std::string_view str,
+    WhiteSpaceClass  whiteSpaceClass /* = WhiteSpaceClass::Ascii */) noexcept
+{
+    auto first = FindFirstNotWhiteSpace(str, whiteSpaceClass);
+    if(first == std::string_view::npos)
+        return std::string_view();
+
+    auto last = FindLastNotWhiteSpace(str, whiteSpaceClass);
+    return str.substr(first, last - first + 1);
+}
+
+
+//------------------------------------------------------------------------------
+std::string CoreString::NormalizeWhiteSpace(
+    std::string_view str,
+    bool             keepNewLines    /* = false */,
+    WhiteSpaceClass  whiteSpaceClass /* = WhiteSpaceClass::Ascii */)
+{
+    auto normalized_str = std::string();
+    NormalizeWhiteSpaceTo(normalized_str, str, keepNewLines, whiteSpaceClass);
+
+    return normalized_str;
+}
+
+//------------------------------------------------------------------------------
+void CoreString::NormalizeWhiteSpaceTo(
+    std::string      &out,
+    std::string_view  str,
+    bool              keepNewLines    /* = false */,
+    WhiteSpaceClass   whiteSpaceClass /* = WhiteSpaceClass::Ascii */)
+{
+    auto begin = Bytes(str);
+    auto end   = begin + str.size();
+
+    if(whiteSpaceClass == WhiteSpaceClass::Unicode)
+        Normalize<true >(out, begin, end, keepNewLines);
+    else
+        Normalize<false>(out, begin, end, keepNewLines);
+}
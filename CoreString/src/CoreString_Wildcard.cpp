@@ -0,0 +1,266 @@
+// Header
+#include "../include/CoreString_Wildcard.h"
+// std
+#include <algorithm>
+#include <cstring>
+// CoreString
+#include "CoreString_Simd.h"
+
+using namespace CoreString::Private_Simd;
+
+
+//------------------------------------------------------------------------------
+CoreString::WildcardPattern::WildcardPattern(
+    std::string_view pattern,
+    bool             caseSensitive /* = true */) :
+    m_pattern      (pattern),
+    m_minLength    (0),
+    m_caseSensitive(caseSensitive),
+    m_hasStar      (false),
+    m_hasQuestion  (false)
+{
+    m_text.reserve(pattern.size());
+
+    auto index = size_t(0);
+    while(true)
+    {
+        auto star = pattern.find('*', index);
+        auto end  = (star == std::string_view::npos) ? pattern.size() : star;
+
+        auto segment        = Segment();
+        segment.offset      = m_text.size();
+        segment.size        = end - index;
+        segment.hasQuestion = false;
+
+        for(auto i = index; i < end; ++i)
+        {
+            auto c = pattern[i];
+            m_text.push_back(caseSensitive ? c : FoldAscii(c));
+            segment.hasQuestion |= (c == '?');
+        }
+
+        //----------------------------------------------------------------------
+        // Horspool shifts - a '?' matches any char, so no shift can
+        // go past the last one (the last char of the segment excluded).
+        auto size          = segment.size;
+        auto default_shift = uint32_t(size);
+        for(auto i = size_t(0); i + 1 < size; ++i)
+        {
+            if(m_text[segment.offset + i] == '?')
+                default_shift = uint32_t(size - 1 - i);
+        }
+
+        segment.shifts.fill(default_shift);
+        for(auto i = size_t(0); i + 1 < size; ++i)
+        {
+            auto c = m_text[segment.offset + i];
+            if(c == '?')
+                continue;
+
+            auto &shift = segment.shifts[uint8_t(c)];
+            shift = std::min(shift, uint32_t(size - 1 - i));
+        }
+
+        m_minLength   += segment.size;
+        m_hasQuestion |= segment.hasQuestion;
+        m_segments.push_back(segment);
+
+        if(star == std::string_view::npos)
+            break;
+
+        m_hasStar = true;
+        index     = star + 1;
+    }
+}
+
+
+//------------------------------------------------------------------------------
+bool CoreString::WildcardPattern::Match(std::string_view str) const noexcept
+{
+    if(str.size() < m_minLength)
+        return false;
+
+    const auto &first = m_segments.front();
+    if(!m_hasStar)
+        return str.size() == first.size && MatchAt(first, str.data());
+
+    //--------------------------------------------------------------------------
+    // Anchored ends.
+    const auto &last = m_segments.back();
+    if(!MatchAt(first, str.data()))
+        return false;
+    if(!MatchAt(last, str.data() + str.size() - last.size))
+        return false;
+
+    //--------------------------------------------------------------------------
+    // The middle segments are searched in order, taking always the
+    // leftmost match leaves the most room to the next ones.
+    auto middle = str.substr(0, str.size() - last.size);
+    auto index  = first.size;
+
+    for(auto i = size_t(1); i + 1 < m_segments.size(); ++i)
+    {
+        const auto &segment = m_segments[i];
+        if(segment.size == 0)
+            continue;
+
+        auto found = Search(segment, middle, index);
+        if(found == std::string_view::npos)
+            return false;
+
+        index = found + segment.size;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+int CoreString::WildcardPattern::FirstChar() const noexcept
+{
+    const auto &first = m_segments.front();
+    if(first.size == 0 || m_text[first.offset] == '?')
+        return -1;
+
+    return uint8_t(m_text[first.offset]);
+}
+
+
+//------------------------------------------------------------------------------
+bool CoreString::WildcardPattern::MatchAt(
+    const Segment &segment,
+    const char    *data) const noexcept
+{
+    auto text = m_text.data() + segment.offset;
+    if(m_caseSensitive && !segment.hasQuestion)
+        return std::memcmp(text, data, segment.size) == 0;
+
+    for(auto i = size_t(0); i < segment.size; ++i)
+    {
+        if(text[i] == '?')
+            continue;
+
+        auto c = (m_caseSensitive) ? data[i] : FoldAscii(data[i]);
+        if(c != text[i])
+            return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+size_t CoreString::WildcardPattern::Search(
+    const Segment    &segment,
+    std::string_view  str,
+    size_t            begin) const noexcept
+{
+    // Plain literals go to the std's find (that is memchr based).
+    if(m_caseSensitive && !segment.hasQuestion)
+    {
+        auto text = std::string_view(m_text.data() + segment.offset, segment.size);
+        return str.find(text, begin);
+    }
+
+    auto size = segment.size;
+    for(auto index = begin; index + size <= str.size();)
+    {
+        if(MatchAt(segment, str.data() + index))
+            return index;
+
+        auto c = str[index + size - 1];
+        if(!m_caseSensitive)
+            c = FoldAscii(c);
+
+        index += segment.shifts[uint8_t(c)];
+    }
+
+    return std::string_view::npos;
+}
+
+
+//------------------------------------------------------------------------------
+CoreString::WildcardSet::WildcardSet(
+    const std::vector<std::string> &patterns,
+    bool                            caseSensitive /* = true */) :
+    m_caseSensitive(caseSensitive)
+{
+    m_patterns.reserve(patterns.size());
+    for(const auto &pattern : patterns)
+        m_patterns.emplace_back(pattern, caseSensitive);
+
+    // The patterns won't move anymore, so it's safe to take the views.
+    for(auto i = size_t(0); i < m_patterns.size(); ++i)
+    {
+        const auto &pattern = m_patterns[i];
+        if(pattern.IsLiteral())
+        {
+            // emplace keeps the first index of repeated patterns.
+            if(caseSensitive)
+                m_literals.emplace(pattern.Pattern(), i);
+            else
+                m_foldedLiterals.emplace(pattern.Pattern(), i);
+
+            continue;
+        }
+
+        auto first_char = pattern.FirstChar();
+        if(first_char < 0)
+            m_unanchored.push_back(i);
+        else
+            m_byFirstChar[first_char].push_back(i);
+    }
+}
+
+
+//------------------------------------------------------------------------------
+bool CoreString::WildcardSet::MatchAny(std::string_view str) const noexcept
+{
+    return FirstMatch(str) != std::string::npos;
+}
+
+//------------------------------------------------------------------------------
+size_t CoreString::WildcardSet::FirstMatch(std::string_view str) const noexcept
+{
+    auto best = std::string::npos;
+
+    //--------------------------------------------------------------------------
+    // All the literals at once.
+    if(m_caseSensitive)
+    {
+        auto it = m_literals.find(str);
+        if(it != std::end(m_literals))
+            best = it->second;
+    }
+    else
+    {
+        auto it = m_foldedLiterals.find(str);
+        if(it != std::end(m_foldedLiterals))
+            best = it->second;
+    }
+
+    //--------------------------------------------------------------------------
+    // Only the patterns that can start with str's first char, merging
+    // the two sorted lists so the lowest index is found first.
+    static const std::vector<size_t> s_empty;
+
+    auto c        = (str.empty()) ? char(0) : str[0];
+    auto &by_char = (str.empty())
+        ? s_empty
+        : m_byFirstChar[uint8_t(m_caseSensitive ? c : FoldAscii(c))];
+
+    auto it_char = std::begin(by_char);
+    auto it_any  = std::begin(m_unanchored);
+    while(it_char != std::end(by_char) || it_any != std::end(m_unanchored))
+    {
+        auto take_char = (it_any == std::end(m_unanchored)) ||
+                         (it_char != std::end(by_char) && *it_char < *it_any);
+
+        auto index = (take_char) ? *it_char++ : *it_any++;
+        if(index >= best)
+            break;
+
+        if(m_patterns[index].Match(str))
+            return index;
+    }
+
+    return best;
+}
@@ -122,6 +122,15 @@ int main() {
     for(const auto &i : v)
         cout << i << endl;
 
+    //--------------------------------------------------------------------------
+    cout << "Split Interned: " << endl;
+    CoreString::InternPool pool;
+    auto iv = CoreString::Split("GET,POST,GET,PUT", ',', pool);
+    for(const auto &i : iv)
+        cout << i << endl;
+    cout << (iv[0].data() == iv[2].data()) << endl;
+    cout << pool.Size()                    << endl;
+
     //--------------------------------------------------------------------------
     cout << "Starts With: "                                   << endl;
     cout << CoreString::StartsWith("ola mundo", "ola")        << endl;
@@ -0,0 +1,19 @@
+// Two translation units that include CoreString.h in header only mode,
+// so any definition that isn't inline fails to link.
+
+// CoreString
+#include "CoreString/CoreString.h"
+
+
+//------------------------------------------------------------------------------
+int HeaderOnlyB();
+
+//------------------------------------------------------------------------------
+int main()
+{
+    auto ok = CoreString::IsDigit("123") == CoreString::IsDigit("123")
+           && CoreString::StartsWith("CoreString", "Core")
+           && CoreString::Trim("  a  ") == "a";
+
+    return (ok && HeaderOnlyB() == 0) ? 0 : 1;
+}
@@ -0,0 +1,15 @@
+// See CoreString_HeaderOnly_A.cpp.
+
+// CoreString
+#include "CoreString/CoreString.h"
+
+
+//------------------------------------------------------------------------------
+int HeaderOnlyB()
+{
+    auto ok = CoreString::PadLeft("a", 3) == "  a"
+           && CoreString::IndexOf("abc", 'c') == 2
+           && CoreString::Replace("abcab", "ab", "x") == "xcx";
+
+    return (ok) ? 0 : 1;
+}